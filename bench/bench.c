@@ -0,0 +1,219 @@
+/*
+ * Headless benchmark of the particle update.
+ *
+ * Fills an emitter and runs the cpu update for a number of frames, then
+ * reports the time and the memory traffic per particle split by attribute
+ * class, derived from the survivors and copies the updates reported. The
+ * simulation runs in lockstep, the final checksum must not change with the
+ * number of threads. A trail length records the particle history as well,
+ * the checksum covers it.
+ *
+ * With --overdraw the emitter of the demo runs for a number of frames
+ * instead, then the fragments its billboards shade are counted in software
+ * for the quad and the octagon geometry, at full and at half resolution.
+ *
+ * Usage: ./bench [num_particles] [frames] [threads] [trail_length]
+ *        ./bench --overdraw [frames]
+ *
+ */
+
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cglm/struct.h"
+
+#include "demo.h"
+#include "overdraw.h"
+#include "particles.h"
+#include "quad.h"
+
+#define OVERDRAW_WIDTH 800
+#define OVERDRAW_HEIGHT 600
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void print_overdraw(const char* name, overdraw_s* o, const particles_s* p, 
+                           const overdraw_geometry_s* geometry, mat4s view, mat4s proj) {
+    const overdraw_stats_s stats = overdraw_measure(o, p, geometry, view, proj);
+    const double covered = stats.covered_pixels > 0 ? (double)stats.covered_pixels : 1.0;
+
+    printf("%-8s %4dx%-4d %10zu %10zu (%5.1f%%) %8zu %7.2f %5" PRIu32 "\n",
+        name, o->width, o->height,
+        stats.fragments, stats.wasted_fragments,
+        stats.fragments > 0 ? 100.0 * (double)stats.wasted_fragments / (double)stats.fragments : 0.0,
+        stats.covered_pixels, (double)stats.fragments / covered, stats.max_overdraw
+    );
+}
+
+static int bench_overdraw(int argc, char *argv[]) {
+    const int frames = argc > 1 ? atoi(argv[1]) : 600;
+    const float dt = 1.0f / 60.0f;
+
+    if (frames <= 0) {
+        fprintf(stderr, "usage: %s --overdraw [frames]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // same emitter and first camera position as the demo
+    emitter_s emitter;
+    emitter_init(&emitter, &(emitter_desc_s){
+        .emission_rate = DEMO_EMISSION_RATE,
+        .emit = demo_emit_particle,
+        .fixed_dt = dt,
+        .seed = 1,
+        .particles_desc = &(particles_desc_s){
+            .max_particles = DEMO_MAX_PARTICLES,
+            .color_stops = demo_color_stops,
+            .num_color_stops = DEMO_NUM_COLOR_STOPS,
+            .size_stops = demo_size_stops,
+            .num_size_stops = DEMO_NUM_SIZE_STOPS
+        }
+    });
+
+    for (int f = 0; f < frames; f++) {
+        emitter_advance(&emitter, dt);
+    }
+
+    const mat4s proj = glms_perspective(
+        glm_rad(60.0f), 
+        (float)OVERDRAW_WIDTH / (float)OVERDRAW_HEIGHT, 
+        0.01f, 50.0f
+    );
+    const mat4s view = glms_lookat(
+        (vec3s){ .x = 0.0f, .y = 1.5f, .z = 5.0f },
+        (vec3s){ .x = 0.0f, .y = 0.0f, .z = 0.0f },
+        (vec3s){ .x = 0.0f, .y = 1.0f, .z = 0.0f }
+    );
+
+    const overdraw_geometry_s quad = {
+        .vertices = quad_vertices,
+        .indices = quad_indices,
+        .num_indices = sizeof(quad_indices) / sizeof(quad_indices[0])
+    };
+    const overdraw_geometry_s octagon = {
+        .vertices = octagon_vertices,
+        .indices = octagon_indices,
+        .num_indices = sizeof(octagon_indices) / sizeof(octagon_indices[0])
+    };
+
+    overdraw_s full, half;
+    overdraw_init(&full, OVERDRAW_WIDTH, OVERDRAW_HEIGHT);
+    overdraw_init(&half, OVERDRAW_WIDTH / 2, OVERDRAW_HEIGHT / 2);
+
+    printf("particles:          %zu after %d frames\n", emitter.particles.num_particles, frames);
+    printf("geometry resolution  fragments     wasted           covered average   max\n");
+    print_overdraw("quad", &full, &emitter.particles, &quad, view, proj);
+    print_overdraw("octagon", &full, &emitter.particles, &octagon, view, proj);
+    print_overdraw("quad", &half, &emitter.particles, &quad, view, proj);
+    print_overdraw("octagon", &half, &emitter.particles, &octagon, view, proj);
+
+    overdraw_deinit(&half);
+    overdraw_deinit(&full);
+    emitter_deinit(&emitter);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--overdraw") == 0) {
+        return bench_overdraw(argc - 1, argv + 1);
+    }
+
+    const size_t num_particles = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    const int frames = argc > 2 ? atoi(argv[2]) : 100;
+    const int threads = argc > 3 ? atoi(argv[3]) : 1;
+    const int trail_length = argc > 4 ? atoi(argv[4]) : 0;
+    const float dt = 1.0f / 60.0f;
+
+    if (num_particles == 0 || frames <= 0 || 
+        threads <= 0 || threads > PARTICLES_MAX_THREADS || trail_length < 0) {
+        fprintf(stderr, "usage: %s [num_particles] [frames] [threads] [trail_length]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    emitter_s emitter;
+    emitter_init(&emitter, &(emitter_desc_s){
+        .emission_rate = 0.0f,
+        .emit = demo_emit_particle,
+        .fixed_dt = dt,
+        .seed = 1,
+        .num_threads = (size_t)threads,
+        .particles_desc = &(particles_desc_s){
+            .max_particles = num_particles,
+            .start_color = (vec4s){ .r = 1.0f, .g = 0.5f, .b = 0.0f, .a = 1.0f },
+            .end_color = (vec4s){ .r = 1.0f, .g = 0.0f, .b = 0.0f, .a = 0.0f },
+            .trail_length = (size_t)trail_length
+        }
+    });
+    emitter_emit_batch(&emitter, num_particles);
+
+    // refill what expired so every frame updates a full emitter, in
+    // lockstep with dt every frame runs exactly one update
+    double seconds = 0.0;
+    size_t updated = 0;
+    size_t survived = 0;
+    size_t moved = 0;
+    size_t joined = 0;
+    for (int f = 0; f < frames; f++) {
+        updated += emitter.particles.num_particles;
+
+        const double start = now_seconds();
+        emitter_advance(&emitter, dt);
+        seconds += now_seconds() - start;
+
+        survived += emitter.particles.num_particles;
+        moved += emitter.particles.num_moved;
+        joined += emitter.particles.num_joined;
+
+        emitter_emit_batch(&emitter, num_particles - emitter.particles.num_particles);
+    }
+
+    // traffic from what the updates did: every particle reads its hot
+    // attributes, survivors write position and lifetime back, write the
+    // warm attributes and record their position in the current trail slot,
+    // the last two cost a read for ownership of the cache line as well, a
+    // particle swapped into a gap within its chunk is read and written
+    // without the warm attributes, one joined across chunks in full
+    const particles_s* p = &emitter.particles;
+    const size_t trail_bytes = p->trail_length * sizeof(vec3s);
+    const size_t swap_bytes = PARTICLES_HOT_BYTES + trail_bytes;
+    const size_t join_bytes = swap_bytes + PARTICLES_WARM_BYTES;
+    const double per_particle = 1.0 / (double)updated;
+
+    const double hot_read = (double)(PARTICLES_HOT_BYTES * updated) * per_particle;
+    const double hot_write = (double)((sizeof(vec3s) + sizeof(float)) * survived) * per_particle;
+    const double warm_write = (double)(PARTICLES_WARM_BYTES * survived) * per_particle;
+    const double trail_write = p->trail_length > 0 ?
+        (double)(sizeof(vec3s) * survived) * per_particle : 0.0;
+    const double copies = (double)(2 * (swap_bytes * moved + join_bytes * joined)) * per_particle;
+    const double bytes = hot_read + hot_write + 2.0 * (warm_write + trail_write) + copies;
+    const double ns = seconds * 1e9 * per_particle;
+
+    printf("particles:          %zu\n", num_particles);
+    printf("frames:             %d\n", frames);
+    printf("threads:            %d\n", threads);
+    printf("survivors:          %.2f%%\n", 100.0 * (double)survived * per_particle);
+    printf("copied:             %.2f%% within chunks, %.2f%% across chunks\n",
+        100.0 * (double)moved * per_particle, 100.0 * (double)joined * per_particle);
+    printf("time per particle:  %.3f ns\n", ns);
+    printf("hot read:           %.2f bytes/particle\n", hot_read);
+    printf("hot write:          %.2f bytes/particle\n", hot_write);
+    printf("warm write:         %.2f bytes/particle (+%.2f read for ownership)\n", warm_write, warm_write);
+    printf("trail write:        %.2f bytes/particle (+%.2f read for ownership)\n", trail_write, trail_write);
+    printf("copies:             %.2f bytes/particle\n", copies);
+    printf("cold:               0 bytes/particle\n");
+    printf("total moved:        %.2f bytes/particle\n", bytes);
+    printf("bandwidth:          %.2f GB/s\n", bytes / ns);
+    printf("checksum:           %016" PRIx64 "\n", emitter_checksum(&emitter));
+
+    emitter_deinit(&emitter);
+    return EXIT_SUCCESS;
+}
@@ -1,4 +1,5 @@
 import argparse
+import math
 from PIL import Image
 
 def generate_fuzzball(diameter: int, base_color: int, alpha_start: int, alpha_end: int) -> list[int]:
@@ -38,6 +39,48 @@ def generate_fuzzball(diameter: int, base_color: int, alpha_start: int, alpha_en
     print("Fuzzball generation complete.")
     return fuzzball
 
+def generate_octagon(fuzzball: list[int], diameter: int, alpha_threshold: int = 0) -> list[tuple[float, float]]:
+    """
+    Generate a tight octagon around all texels with an alpha above the threshold.
+    Texels are grown by half a texel, as far as bilinear filtering spreads them.
+    Returns the eight corners as (u, v) texture coordinates, counter-clockwise
+    on screen (v points down).
+    """
+    assert len(fuzzball) == diameter * diameter, "Fuzzball size does not match diameter"
+    assert 0 <= alpha_threshold <= 255, "Alpha threshold must be between 0 and 255"
+
+    corners = list()
+    for y in range(diameter):
+        for x in range(diameter):
+            if (fuzzball[y * diameter + x] >> 24) & 0xFF > alpha_threshold:
+                for cx in (x - 0.5, x + 1.5):
+                    for cy in (y - 0.5, y + 1.5):
+                        corners.append((cx, cy))
+
+    assert corners, "Fuzzball has no texels above the alpha threshold"
+
+    # support of the texels along eight directions, clamped to the quad
+    directions = [(math.cos(k * math.pi / 4), math.sin(k * math.pi / 4)) for k in range(8)]
+    bounds = [(0.0, 0.0), (diameter, 0.0), (diameter, diameter), (0.0, diameter)]
+    support = [
+        min(max(dx * cx + dy * cy for cx, cy in corners), 
+            max(dx * bx + dy * by for bx, by in bounds))
+        for dx, dy in directions
+    ]
+
+    # corners are the intersections of neighbouring support lines
+    octagon = list()
+    for k in range(8):
+        (ax, ay), ha = directions[k], support[k]
+        (bx, by), hb = directions[(k + 1) % 8], support[(k + 1) % 8]
+        det = ax * by - ay * bx
+        x = (ha * by - hb * ay) / det
+        y = (ax * hb - bx * ha) / det
+        octagon.append((round(x / diameter, 6) + 0.0, round(y / diameter, 6) + 0.0))
+
+    # directions turn clockwise on screen, reverse for counter-clockwise
+    return octagon[::-1]
+
 def preview(fuzzball: list[int], diameter: int):
     """
     Preview the generated fuzzball using PIL.
@@ -70,6 +113,8 @@ if __name__ == "__main__":
     parser.add_argument("-s" ,"--alpha_start", type=int, default=255, help="Starting alpha value (0-255)")
     parser.add_argument("-e" ,"--alpha_end", type=int, default=0, help="Ending alpha value (0-255)")
     parser.add_argument("-p", "--preview", action="store_true", help="Preview the generated fuzzball")
+    parser.add_argument("-o", "--octagon", action="store_true", help="Print a tight octagon billboard for quad.c")
+    parser.add_argument("-t", "--alpha_threshold", type=int, default=0, help="Alpha the octagon may cut off (0-255)")
     
     args = parser.parse_args()
 
@@ -77,5 +122,16 @@ if __name__ == "__main__":
     print(f"Fuzzball ({args.diameter} x {args.diameter}):")
     print(", ".join(f"0x{c:08X}" for c in fuzzball))
 
+    if args.octagon:
+        octagon = generate_octagon(fuzzball, args.diameter, args.alpha_threshold)
+        area = 0.5 * abs(sum(
+            u0 * v1 - u1 * v0 
+            for (u0, v0), (u1, v1) in zip(octagon, octagon[1:] + octagon[:1])
+        ))
+        print(f"Octagon ({area * 100:.1f}% of the quad):")
+        for u, v in octagon:
+            print(f"    {{ .pos = {{{{ {2.0 * u - 1.0:7.4f}f * QUAD_SIZE, {1.0 - 2.0 * v:7.4f}f * QUAD_SIZE, 0.0f }}}}, "
+                  f".uv = {{{{ {u:.4f}f, {v:.4f}f }}}} }},")
+
     if args.preview:
         preview(fuzzball, args.diameter)
@@ -0,0 +1,28 @@
+@vs composite_vs
+out vec2 uv;
+
+void main() {
+    // a single triangle covering the whole screen, needs no vertex buffer
+    vec2 pos = vec2(float((gl_VertexIndex << 1) & 2), float(gl_VertexIndex & 2));
+
+    gl_Position = vec4(pos * 2.0f - 1.0f, 0.0f, 1.0f);
+
+    uv = pos;
+}
+@end
+
+@fs composite_fs
+layout(binding=0) uniform texture2D composite_tex;
+layout(binding=0) uniform sampler composite_smp;
+
+in vec2 uv;
+
+out vec4 frag_color;
+
+void main() {
+    // the offscreen target holds premultiplied color, blended with ONE
+    frag_color = texture(sampler2D(composite_tex, composite_smp), uv);
+}
+@end
+
+@program composite composite_vs composite_fs
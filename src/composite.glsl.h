@@ -0,0 +1,123 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i src/composite.glsl -o src/composite.glsl.h -l glsl430
+
+    Overview:
+    =========
+    Shader program: 'composite':
+        Get shader desc: composite_shader_desc(sg_query_backend());
+        Vertex Shader: composite_vs
+        Fragment Shader: composite_fs
+    Bindings:
+        Texture 'composite_tex':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: VIEW_composite_tex => 0
+        Sampler 'composite_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_composite_smp => 0
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before composite.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define VIEW_composite_tex (0)
+#define SMP_composite_smp (0)
+/*
+    #version 430
+
+    layout(location = 0) out vec2 uv;
+
+    void main()
+    {
+        vec2 _28 = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+        gl_Position = vec4((_28 * 2.0) - vec2(1.0), 0.0, 1.0);
+        uv = _28;
+    }
+
+*/
+static const uint8_t composite_vs_source_glsl430[216] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x38,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,
+    0x74,0x65,0x78,0x49,0x44,0x20,0x3c,0x3c,0x20,0x31,0x29,0x20,0x26,0x20,0x32,0x29,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,
+    0x78,0x49,0x44,0x20,0x26,0x20,0x32,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x28,0x5f,0x32,0x38,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x5f,
+    0x32,0x38,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    layout(binding = 0) uniform sampler2D composite_tex_composite_smp;
+
+    layout(location = 0) out vec4 frag_color;
+    layout(location = 0) in vec2 uv;
+
+    void main()
+    {
+        frag_color = texture(composite_tex_composite_smp, uv);
+    }
+
+*/
+static const uint8_t composite_fs_source_glsl430[235] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x74,0x65,
+    0x78,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x73,0x6d,0x70,0x3b,
+    0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* composite_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)composite_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)composite_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.views[0].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[0].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[0].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[0].texture.multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 0;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[0].glsl_name = "composite_tex_composite_smp";
+            desc.label = "composite_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
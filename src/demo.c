@@ -0,0 +1,41 @@
+#include "demo.h"
+
+const color_stop_s demo_color_stops[DEMO_NUM_COLOR_STOPS] = {
+    { .t = 0.0f, .color = { .r = 1.0f, .g = 0.9f, .b = 0.5f, .a = 1.0f } },
+    { .t = 0.2f, .color = { .r = 1.0f, .g = 0.5f, .b = 0.0f, .a = 1.0f } },
+    { .t = 1.0f, .color = { .r = 1.0f, .g = 0.0f, .b = 0.0f, .a = 0.0f } }
+};
+
+const size_stop_s demo_size_stops[DEMO_NUM_SIZE_STOPS] = {
+    { .t = 0.0f, .size = 0.5f },
+    { .t = 0.3f, .size = 1.5f },
+    { .t = 1.0f, .size = 0.8f }
+};
+
+/*
+ * @brief Emits a particle rising from the emitter in a narrow cone
+ *
+ * @param e Pointer to the emitter structure
+ */
+void demo_emit_particle(emitter_s* e) {
+    demo_emit_particle_lifetime(e, DEMO_MIN_LIFETIME, DEMO_MAX_LIFETIME);
+}
+
+/*
+ * @brief Emits a demo particle with a lifetime drawn from the given range
+ *
+ * @param e Pointer to the emitter structure
+ * @param min_lifetime Shortest lifetime in seconds
+ * @param max_lifetime Longest lifetime in seconds
+ */
+void demo_emit_particle_lifetime(emitter_s* e, float min_lifetime, float max_lifetime) {
+    emitter_add_particle(e, &(particle_desc_s){
+        .position = (vec3s){ },
+        .velocity = (vec3s){ 
+            .x = emitter_randf(e, -0.5f, 0.5f), 
+            .y = emitter_randf(e, 1.0f, 3.0f), 
+            .z = emitter_randf(e, -0.5f, 0.5f) 
+        },
+        .lifetime = emitter_randf(e, min_lifetime, max_lifetime)
+    });
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "particles.h"
+
+// emitter of the demo, shared with the headless benchmarks
+#define DEMO_EMISSION_RATE 50.0f
+#define DEMO_MAX_PARTICLES 1024
+#define DEMO_NUM_COLOR_STOPS 3
+#define DEMO_NUM_SIZE_STOPS 3
+#define DEMO_MIN_LIFETIME 1.0f
+#define DEMO_MAX_LIFETIME 5.0f
+
+extern const color_stop_s demo_color_stops[DEMO_NUM_COLOR_STOPS];
+extern const size_stop_s demo_size_stops[DEMO_NUM_SIZE_STOPS];
+
+void demo_emit_particle(emitter_s* e);
+void demo_emit_particle_lifetime(emitter_s* e, float min_lifetime, float max_lifetime);
@@ -0,0 +1,131 @@
+// particle state for the gpu simulation, filled from the cpu side in gpu_sim.c
+@block particle_types
+struct gpu_particle {
+    vec3 pos;
+    float lifetime;
+    vec3 vel;
+    float inv_lifetime;
+    vec4 color;
+    float size;
+    int slot; // slot a spawn is written to, assigned on the cpu
+};
+
+struct gpu_lut_entry {
+    vec4 color;
+    float size;
+};
+@end
+
+@cs gpu_emit_cs
+@include_block particle_types
+
+layout(binding=0) uniform cs_emit_params {
+    int num_spawns;
+};
+
+layout(binding=0) buffer cs_particles {
+    gpu_particle prt[];
+};
+
+layout(binding=2) readonly buffer cs_spawns {
+    gpu_particle spawns[];
+};
+
+layout(local_size_x=64, local_size_y=1, local_size_z=1) in;
+
+void main() {
+    int i = int(gl_GlobalInvocationID.x);
+    if (i >= num_spawns) {
+        return;
+    }
+
+    // the cpu only hands out slots whose particle has expired
+    prt[spawns[i].slot] = spawns[i];
+}
+@end
+
+@cs gpu_update_cs
+@include_block particle_types
+
+layout(binding=0) uniform cs_update_params {
+    float dt;
+};
+
+layout(binding=0) buffer cs_particles {
+    gpu_particle prt[];
+};
+
+layout(binding=1) readonly buffer cs_lut {
+    gpu_lut_entry lut[];
+};
+
+layout(local_size_x=64, local_size_y=1, local_size_z=1) in;
+
+#define KERNEL_PRECISE precise
+#define KERNEL_INT(x) int(x)
+#define KERNEL_FLOAT(x) float(x)
+
+void main() {
+    int i = int(gl_GlobalInvocationID.x);
+    if (i >= prt.length()) {
+        return;
+    }
+    int lut_length = lut.length();
+
+@include gpu_update_kernel.h
+}
+@end
+
+@vs gpu_vs
+@include_block particle_types
+
+layout(binding=0) uniform gpu_vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 proj;
+};
+
+layout(binding=0) readonly buffer vs_particles {
+    gpu_particle vs_prt[];
+};
+
+in vec3 pos;
+in vec2 uv0;
+
+out vec4 color;
+out vec2 uv;
+
+void main() {
+    gpu_particle p = vs_prt[gl_InstanceIndex];
+
+    vec3 cam_right = vec3(view[0][0], view[1][0], view[2][0]);
+    vec3 cam_up = vec3(view[0][1], view[1][1], view[2][1]);
+
+    vec3 world_pos = p.pos
+        + p.size * (pos.x * cam_right + pos.y * cam_up);
+
+    gl_Position = proj * view * model * vec4(world_pos, 1.0f);
+
+    color = p.color;
+
+    uv = uv0;
+}
+@end
+
+@fs gpu_fs
+layout(binding=1) uniform texture2D gpu_tex;
+layout(binding=0) uniform sampler gpu_smp;
+
+in vec4 color;
+in vec2 uv;
+
+out vec4 frag_color;
+
+void main() {
+    frag_color = texture(sampler2D(gpu_tex, gpu_smp), uv) * color;
+}
+@end
+
+@program gpu_emit gpu_emit_cs
+@program gpu_update gpu_update_cs
+@program gpu_render gpu_vs gpu_fs
@@ -0,0 +1,593 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i src/gpu_particles.glsl -o src/gpu_particles.glsl.h -l glsl430
+
+    Overview:
+    =========
+    Shader program: 'gpu_emit':
+        Get shader desc: gpu_emit_shader_desc(sg_query_backend());
+        Compute Shader: gpu_emit_cs
+    Bindings:
+        Uniform block 'cs_emit_params':
+            C struct: cs_emit_params_t
+            Bind slot: UB_cs_emit_params => 0
+        Storage buffer 'cs_particles':
+            C struct: gpu_particle_t
+            Bind slot: VIEW_cs_particles => 0
+            Readonly: false
+        Storage buffer 'cs_spawns':
+            C struct: gpu_particle_t
+            Bind slot: VIEW_cs_spawns => 2
+            Readonly: true
+    Shader program: 'gpu_update':
+        Get shader desc: gpu_update_shader_desc(sg_query_backend());
+        Compute Shader: gpu_update_cs
+    Bindings:
+        Uniform block 'cs_update_params':
+            C struct: cs_update_params_t
+            Bind slot: UB_cs_update_params => 0
+        Storage buffer 'cs_particles':
+            C struct: gpu_particle_t
+            Bind slot: VIEW_cs_particles => 0
+            Readonly: false
+        Storage buffer 'cs_lut':
+            C struct: gpu_lut_entry_t
+            Bind slot: VIEW_cs_lut => 1
+            Readonly: true
+    Shader program: 'gpu_render':
+        Get shader desc: gpu_render_shader_desc(sg_query_backend());
+        Vertex Shader: gpu_vs
+        Fragment Shader: gpu_fs
+        Attributes:
+            ATTR_gpu_render_pos => 0
+            ATTR_gpu_render_uv0 => 1
+    Bindings:
+        Uniform block 'gpu_vs_params':
+            C struct: gpu_vs_params_t
+            Bind slot: UB_gpu_vs_params => 0
+        Storage buffer 'vs_particles':
+            C struct: gpu_particle_t
+            Bind slot: VIEW_vs_particles => 0
+            Readonly: true
+        Texture 'gpu_tex':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: VIEW_gpu_tex => 1
+        Sampler 'gpu_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_gpu_smp => 0
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before gpu_particles.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define ATTR_gpu_render_pos (0)
+#define ATTR_gpu_render_uv0 (1)
+#define UB_cs_emit_params (0)
+#define UB_cs_update_params (0)
+#define UB_gpu_vs_params (0)
+#define VIEW_cs_particles (0)
+#define VIEW_cs_lut (1)
+#define VIEW_cs_spawns (2)
+#define VIEW_vs_particles (0)
+#define VIEW_gpu_tex (1)
+#define SMP_gpu_smp (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct cs_emit_params_t {
+    int32_t num_spawns;
+    uint8_t _pad_4[12];
+} cs_emit_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct cs_update_params_t {
+    float dt;
+    uint8_t _pad_4[12];
+} cs_update_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct gpu_vs_params_t {
+    float model[16];
+    float view[16];
+    float proj[16];
+} gpu_vs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct gpu_particle_t {
+    float pos[3];
+    float lifetime;
+    float vel[3];
+    float inv_lifetime;
+    float color[4];
+    float size;
+    int32_t slot;
+    uint8_t _pad_56[8];
+} gpu_particle_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct gpu_lut_entry_t {
+    float color[4];
+    float size;
+    uint8_t _pad_20[12];
+} gpu_lut_entry_t;
+#pragma pack(pop)
+/*
+    #version 430
+    layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+    struct gpu_particle
+    {
+        vec3 pos;
+        float lifetime;
+        vec3 vel;
+        float inv_lifetime;
+        vec4 color;
+        float size;
+        int slot;
+    };
+
+    uniform ivec4 cs_emit_params[1];
+    layout(binding = 0, std430) buffer cs_particles
+    {
+        gpu_particle prt[];
+    } _37;
+
+    layout(binding = 2, std430) readonly buffer cs_spawns
+    {
+        gpu_particle spawns[];
+    } _52;
+
+    void main()
+    {
+        int _15 = int(gl_GlobalInvocationID.x);
+        if (_15 >= cs_emit_params[0].x)
+        {
+            return;
+        }
+        _37.prt[_52.spawns[_15].slot] = _52.spawns[_15];
+    }
+
+*/
+static const uint8_t gpu_emit_cs_source_glsl430[609] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x78,
+    0x20,0x3d,0x20,0x36,0x34,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,
+    0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,
+    0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x67,0x70,0x75,0x5f,0x70,0x61,0x72,0x74,0x69,
+    0x63,0x6c,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,
+    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,
+    0x66,0x65,0x74,0x69,0x6d,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x76,0x65,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x69,0x6e,0x76,0x5f,0x6c,0x69,0x66,0x65,0x74,0x69,0x6d,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x69,0x76,0x65,0x63,0x34,0x20,0x63,0x73,
+    0x5f,0x65,0x6d,0x69,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,
+    0x3d,0x20,0x30,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x20,0x63,0x73,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x73,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x70,0x75,0x5f,0x70,0x61,0x72,0x74,0x69,
+    0x63,0x6c,0x65,0x20,0x70,0x72,0x74,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x33,0x37,
+    0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,
+    0x67,0x20,0x3d,0x20,0x32,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,
+    0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x63,
+    0x73,0x5f,0x73,0x70,0x61,0x77,0x6e,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,
+    0x70,0x75,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x20,0x73,0x70,0x61,0x77,
+    0x6e,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x35,0x32,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x5f,0x31,0x35,0x20,0x3e,0x3d,0x20,0x63,0x73,0x5f,0x65,0x6d,0x69,0x74,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x37,0x2e,
+    0x70,0x72,0x74,0x5b,0x5f,0x35,0x32,0x2e,0x73,0x70,0x61,0x77,0x6e,0x73,0x5b,0x5f,
+    0x31,0x35,0x5d,0x2e,0x73,0x6c,0x6f,0x74,0x5d,0x20,0x3d,0x20,0x5f,0x35,0x32,0x2e,
+    0x73,0x70,0x61,0x77,0x6e,0x73,0x5b,0x5f,0x31,0x35,0x5d,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #version 430
+    layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+    struct gpu_particle
+    {
+        vec3 pos;
+        float lifetime;
+        vec3 vel;
+        float inv_lifetime;
+        vec4 color;
+        float size;
+        int slot;
+    };
+
+    struct gpu_lut_entry
+    {
+        vec4 color;
+        float size;
+    };
+
+    layout(binding = 0, std430) buffer cs_particles
+    {
+        gpu_particle prt[];
+    } _27;
+
+    uniform vec4 cs_update_params[1];
+    layout(binding = 1, std430) readonly buffer cs_lut
+    {
+        gpu_lut_entry lut[];
+    } _113;
+
+    void main()
+    {
+        int _15 = int(gl_GlobalInvocationID.x);
+        if (_15 >= int(uint(_27.prt.length())))
+        {
+            return;
+        }
+        int _38 = int(uint(_113.lut.length()));
+        if (_27.prt[_15].lifetime <= 0.0)
+        {
+            return;
+        }
+        precise float _60 = _27.prt[_15].lifetime - cs_update_params[0].x;
+        if (_60 <= 0.0)
+        {
+            _27.prt[_15].lifetime = 0.0;
+            _27.prt[_15].size = 0.0;
+            return;
+        }
+        for (int _72 = 0; _72 < 3; _72++)
+        {
+            precise float _81 = _27.prt[_15].vel[_72] * cs_update_params[0].x;
+            precise float _87 = _27.prt[_15].pos[_72] + _81;
+            _27.prt[_15].pos[_72] = _87;
+        }
+        precise float _95 = 1.0 - (_60 * _27.prt[_15].inv_lifetime);
+        precise float _101 = (_95 < 0.0) ? 0.0 : ((_95 > 1.0) ? 1.0 : _95);
+        precise float _110 = (_101 * float(_38 - 1)) + 0.5;
+        int _121 = int(_110);
+        _27.prt[_15].lifetime = _60;
+        for (int _127 = 0; _127 < 4; _127++)
+        {
+            _27.prt[_15].color[_127] = _113.lut[_121].color[_127];
+        }
+        _27.prt[_15].size = _113.lut[_121].size;
+    }
+
+*/
+static const uint8_t gpu_update_cs_source_glsl430[1551] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x78,
+    0x20,0x3d,0x20,0x36,0x34,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,
+    0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,
+    0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x67,0x70,0x75,0x5f,0x70,0x61,0x72,0x74,0x69,
+    0x63,0x6c,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,
+    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,
+    0x66,0x65,0x74,0x69,0x6d,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x76,0x65,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x69,0x6e,0x76,0x5f,0x6c,0x69,0x66,0x65,0x74,0x69,0x6d,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x67,0x70,0x75,0x5f,0x6c,0x75,0x74,0x5f,0x65,
+    0x6e,0x74,0x72,0x79,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x2c,0x20,0x73,
+    0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x63,0x73,
+    0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x67,0x70,0x75,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x20,0x70,0x72,
+    0x74,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x37,0x3b,0x0a,0x0a,0x75,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x73,0x5f,0x75,0x70,0x64,
+    0x61,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+    0x31,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,
+    0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x63,0x73,0x5f,0x6c,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x70,0x75,0x5f,0x6c,0x75,0x74,0x5f,
+    0x65,0x6e,0x74,0x72,0x79,0x20,0x6c,0x75,0x74,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,
+    0x31,0x31,0x33,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x20,
+    0x3d,0x20,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,
+    0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,0x35,0x20,0x3e,0x3d,0x20,0x69,
+    0x6e,0x74,0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,0x32,0x37,0x2e,0x70,0x72,0x74,0x2e,
+    0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x5f,0x33,0x38,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,
+    0x31,0x31,0x33,0x2e,0x6c,0x75,0x74,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x37,0x2e,
+    0x70,0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,0x2e,0x6c,0x69,0x66,0x65,0x74,0x69,0x6d,
+    0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x63,0x69,0x73,
+    0x65,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x30,0x20,0x3d,0x20,0x5f,0x32,
+    0x37,0x2e,0x70,0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,0x2e,0x6c,0x69,0x66,0x65,0x74,
+    0x69,0x6d,0x65,0x20,0x2d,0x20,0x63,0x73,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x5f,0x36,0x30,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
+    0x32,0x37,0x2e,0x70,0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,0x2e,0x6c,0x69,0x66,0x65,
+    0x74,0x69,0x6d,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x5f,0x32,0x37,0x2e,0x70,0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,
+    0x2e,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,
+    0x5f,0x37,0x32,0x20,0x3d,0x20,0x30,0x3b,0x20,0x5f,0x37,0x32,0x20,0x3c,0x20,0x33,
+    0x3b,0x20,0x5f,0x37,0x32,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x63,0x69,0x73,0x65,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x38,0x31,0x20,0x3d,0x20,0x5f,0x32,0x37,0x2e,0x70,
+    0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,0x2e,0x76,0x65,0x6c,0x5b,0x5f,0x37,0x32,0x5d,
+    0x20,0x2a,0x20,0x63,0x73,0x5f,0x75,0x70,0x64,0x61,0x74,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x70,0x72,0x65,0x63,0x69,0x73,0x65,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x38,0x37,0x20,0x3d,0x20,0x5f,0x32,0x37,0x2e,0x70,0x72,0x74,0x5b,0x5f,0x31,
+    0x35,0x5d,0x2e,0x70,0x6f,0x73,0x5b,0x5f,0x37,0x32,0x5d,0x20,0x2b,0x20,0x5f,0x38,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x37,0x2e,0x70,
+    0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,0x2e,0x70,0x6f,0x73,0x5b,0x5f,0x37,0x32,0x5d,
+    0x20,0x3d,0x20,0x5f,0x38,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x70,0x72,0x65,0x63,0x69,0x73,0x65,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x39,0x35,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x28,0x5f,0x36,0x30,
+    0x20,0x2a,0x20,0x5f,0x32,0x37,0x2e,0x70,0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,0x2e,
+    0x69,0x6e,0x76,0x5f,0x6c,0x69,0x66,0x65,0x74,0x69,0x6d,0x65,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x72,0x65,0x63,0x69,0x73,0x65,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x31,0x30,0x31,0x20,0x3d,0x20,0x28,0x5f,0x39,0x35,0x20,0x3c,0x20,0x30,
+    0x2e,0x30,0x29,0x20,0x3f,0x20,0x30,0x2e,0x30,0x20,0x3a,0x20,0x28,0x28,0x5f,0x39,
+    0x35,0x20,0x3e,0x20,0x31,0x2e,0x30,0x29,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,
+    0x20,0x5f,0x39,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x63,0x69,
+    0x73,0x65,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x31,0x30,0x20,0x3d,0x20,
+    0x28,0x5f,0x31,0x30,0x31,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x33,
+    0x38,0x20,0x2d,0x20,0x31,0x29,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x31,0x32,0x31,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x28,0x5f,0x31,0x31,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x37,
+    0x2e,0x70,0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,0x2e,0x6c,0x69,0x66,0x65,0x74,0x69,
+    0x6d,0x65,0x20,0x3d,0x20,0x5f,0x36,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,
+    0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x5f,0x31,0x32,0x37,0x20,0x3d,0x20,0x30,0x3b,
+    0x20,0x5f,0x31,0x32,0x37,0x20,0x3c,0x20,0x34,0x3b,0x20,0x5f,0x31,0x32,0x37,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x5f,0x32,0x37,0x2e,0x70,0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,0x2e,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5b,0x5f,0x31,0x32,0x37,0x5d,0x20,0x3d,0x20,0x5f,0x31,0x31,0x33,
+    0x2e,0x6c,0x75,0x74,0x5b,0x5f,0x31,0x32,0x31,0x5d,0x2e,0x63,0x6f,0x6c,0x6f,0x72,
+    0x5b,0x5f,0x31,0x32,0x37,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x5f,0x32,0x37,0x2e,0x70,0x72,0x74,0x5b,0x5f,0x31,0x35,0x5d,0x2e,0x73,
+    0x69,0x7a,0x65,0x20,0x3d,0x20,0x5f,0x31,0x31,0x33,0x2e,0x6c,0x75,0x74,0x5b,0x5f,
+    0x31,0x32,0x31,0x5d,0x2e,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    struct gpu_particle
+    {
+        vec3 pos;
+        float lifetime;
+        vec3 vel;
+        float inv_lifetime;
+        vec4 color;
+        float size;
+        int slot;
+    };
+
+    layout(binding = 0, std430) readonly buffer vs_particles
+    {
+        gpu_particle vs_prt[];
+    } _21;
+
+    uniform vec4 gpu_vs_params[12];
+    layout(location = 0) in vec3 pos;
+    layout(location = 0) out vec4 color;
+    layout(location = 1) out vec2 uv;
+    layout(location = 1) in vec2 uv0;
+
+    void main()
+    {
+        gl_Position = ((mat4(gpu_vs_params[8], gpu_vs_params[9], gpu_vs_params[10], gpu_vs_params[11]) * mat4(gpu_vs_params[4], gpu_vs_params[5], gpu_vs_params[6], gpu_vs_params[7])) * mat4(gpu_vs_params[0], gpu_vs_params[1], gpu_vs_params[2], gpu_vs_params[3])) * vec4(_21.vs_prt[gl_InstanceID].pos + (((vec3(gpu_vs_params[4].x, gpu_vs_params[5].x, gpu_vs_params[6].x) * pos.x) + (vec3(gpu_vs_params[4].y, gpu_vs_params[5].y, gpu_vs_params[6].y) * pos.y)) * _21.vs_prt[gl_InstanceID].size), 1.0);
+        color = _21.vs_prt[gl_InstanceID].color;
+        uv = uv0;
+    }
+
+*/
+static const uint8_t gpu_vs_source_glsl430[995] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x67,0x70,0x75,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,
+    0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,0x66,0x65,
+    0x74,0x69,0x6d,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x76,
+    0x65,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,
+    0x76,0x5f,0x6c,0x69,0x66,0x65,0x74,0x69,0x6d,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,
+    0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,
+    0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x74,0x69,0x63,0x6c,0x65,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x70,0x75,
+    0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x20,0x76,0x73,0x5f,0x70,0x72,0x74,
+    0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x31,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x75,0x76,0x30,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x6d,0x61,0x74,0x34,0x28,0x67,
+    0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,
+    0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,
+    0x5d,0x2c,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x30,0x5d,0x2c,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,
+    0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,
+    0x2c,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x35,0x5d,0x2c,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x36,0x5d,0x2c,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x37,0x5d,0x29,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,
+    0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
+    0x2c,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2c,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x32,0x5d,0x2c,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x5f,0x32,0x31,0x2e,0x76,0x73,0x5f,0x70,0x72,0x74,0x5b,0x67,0x6c,0x5f,0x49,0x6e,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x44,0x5d,0x2e,0x70,0x6f,0x73,0x20,0x2b,0x20,
+    0x28,0x28,0x28,0x76,0x65,0x63,0x33,0x28,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2e,0x78,0x2c,0x20,0x67,0x70,0x75,0x5f,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x78,0x2c,0x20,
+    0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,
+    0x2e,0x78,0x29,0x20,0x2a,0x20,0x70,0x6f,0x73,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,
+    0x76,0x65,0x63,0x33,0x28,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x34,0x5d,0x2e,0x79,0x2c,0x20,0x67,0x70,0x75,0x5f,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2e,0x79,0x2c,0x20,0x67,0x70,0x75,
+    0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2e,0x79,0x29,
+    0x20,0x2a,0x20,0x70,0x6f,0x73,0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x32,0x31,
+    0x2e,0x76,0x73,0x5f,0x70,0x72,0x74,0x5b,0x67,0x6c,0x5f,0x49,0x6e,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x49,0x44,0x5d,0x2e,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x5f,0x32,0x31,0x2e,0x76,0x73,0x5f,0x70,0x72,0x74,0x5b,0x67,0x6c,0x5f,0x49,0x6e,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x49,0x44,0x5d,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x30,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    layout(binding = 0) uniform sampler2D gpu_tex_gpu_smp;
+
+    layout(location = 0) out vec4 frag_color;
+    layout(location = 1) in vec2 uv;
+    layout(location = 0) in vec4 color;
+
+    void main()
+    {
+        frag_color = texture(gpu_tex_gpu_smp, uv) * color;
+    }
+
+*/
+static const uint8_t gpu_fs_source_glsl430[255] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x67,0x70,0x75,0x5f,0x74,0x65,0x78,0x5f,0x67,0x70,0x75,0x5f,
+    0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x67,0x70,0x75,
+    0x5f,0x74,0x65,0x78,0x5f,0x67,0x70,0x75,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,
+    0x29,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* gpu_emit_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)gpu_emit_cs_source_glsl430;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_INT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "cs_emit_params";
+            desc.views[0].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[0].storage_buffer.readonly = false;
+            desc.views[0].storage_buffer.glsl_binding_n = 0;
+            desc.views[2].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[2].storage_buffer.readonly = true;
+            desc.views[2].storage_buffer.glsl_binding_n = 2;
+            desc.label = "gpu_emit_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* gpu_update_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)gpu_update_cs_source_glsl430;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "cs_update_params";
+            desc.views[0].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[0].storage_buffer.readonly = false;
+            desc.views[0].storage_buffer.glsl_binding_n = 0;
+            desc.views[1].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[1].storage_buffer.readonly = true;
+            desc.views[1].storage_buffer.glsl_binding_n = 1;
+            desc.label = "gpu_update_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* gpu_render_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)gpu_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)gpu_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "pos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "uv0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "gpu_vs_params";
+            desc.views[0].storage_buffer.stage = SG_SHADERSTAGE_VERTEX;
+            desc.views[0].storage_buffer.readonly = true;
+            desc.views[0].storage_buffer.glsl_binding_n = 0;
+            desc.views[1].texture.stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.views[1].texture.multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].sampler_slot = 0;
+            desc.texture_sampler_pairs[0].glsl_name = "gpu_tex_gpu_smp";
+            desc.label = "gpu_render_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
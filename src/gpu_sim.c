@@ -0,0 +1,374 @@
+#include "gpu_sim.h"
+#include "quad.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+// must match local_size_x of the compute shaders
+#define GPU_SIM_GROUP_SIZE 64
+
+// seconds a slot stays reserved after its particle ran out, covers the
+// rounding of the lifetime the gpu counts down in float for any frame rate
+#define GPU_SIM_REUSE_MARGIN 0.01
+
+
+/*
+ * @brief Number of work groups needed to cover a number of items
+ *
+ * @param num_items Number of items to process
+ */
+static inline int group_count(size_t num_items) {
+    return (int)((num_items + GPU_SIM_GROUP_SIZE - 1) / GPU_SIM_GROUP_SIZE);
+}
+
+/*
+ * @brief Adds an occupied slot to the expiry heap
+ *
+ * @param g Pointer to the gpu simulation structure
+ * @param entry Slot and the time its particle runs out
+ */
+static void expiry_push(gpu_sim_s* g, gpu_slot_expiry_s entry) {
+    assert(g->num_occupied < g->max_particles);
+
+    size_t i = g->num_occupied++;
+    while (i > 0) {
+        const size_t parent = (i - 1) / 2;
+        if (g->expiries[parent].time <= entry.time) {
+            break;
+        }
+        g->expiries[i] = g->expiries[parent];
+        i = parent;
+    }
+    g->expiries[i] = entry;
+}
+
+/*
+ * @brief Removes the slot that runs out first from the expiry heap
+ *
+ * @param g Pointer to the gpu simulation structure, with occupied slots
+ *
+ * @returns The removed slot
+ */
+static uint32_t expiry_pop(gpu_sim_s* g) {
+    assert(g->num_occupied > 0);
+
+    const uint32_t slot = g->expiries[0].slot;
+    const gpu_slot_expiry_s last = g->expiries[--g->num_occupied];
+
+    size_t i = 0;
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= g->num_occupied) {
+            break;
+        }
+        if (child + 1 < g->num_occupied && 
+            g->expiries[child + 1].time < g->expiries[child].time) {
+            child++;
+        }
+        if (last.time <= g->expiries[child].time) {
+            break;
+        }
+        g->expiries[i] = g->expiries[child];
+        i = child;
+    }
+    if (g->num_occupied > 0) {
+        g->expiries[i] = last;
+    }
+
+    return slot;
+}
+
+/*
+ * @brief Checks if the backend can run the compute passes
+ *
+ * @returns true if compute shaders are supported, false otherwise
+ */
+bool gpu_sim_supported(void) {
+    return sg_query_features().compute;
+}
+
+/*
+ * @brief Creates the storage buffers and pipelines of the gpu simulation
+ *
+ * @param g Pointer to the gpu simulation structure to initialize
+ * @param desc Pointer to the gpu simulation description structure
+ *
+ * @note The caller is responsible for calling gpu_sim_deinit()
+ */
+void gpu_sim_init(gpu_sim_s* g, const gpu_sim_desc_s* desc) {
+    assert(g && desc && desc->emitter);
+    assert(desc->num_geometry_indices > 0);
+    assert(gpu_sim_supported());
+
+    const particles_s* p = &desc->emitter->particles;
+    const size_t max_particles = desc->emitter->max_particles;
+
+    *g = (gpu_sim_s){
+        .max_particles = max_particles,
+        .num_geometry_indices = desc->num_geometry_indices,
+        .time = 0.0,
+        .free_slots = malloc(max_particles * sizeof(uint32_t)),
+        .num_free = max_particles,
+        .expiries = malloc(max_particles * sizeof(gpu_slot_expiry_s)),
+        .num_occupied = 0,
+        .spawns = malloc(max_particles * sizeof(gpu_particle_t))
+    };
+    assert(g->free_slots && g->expiries && g->spawns);
+
+    // popped from the back, so the lowest slots are used first
+    for (size_t i = 0; i < max_particles; i++) {
+        g->free_slots[i] = (uint32_t)(max_particles - 1 - i);
+    }
+
+    // all slots start out dead, a zero lifetime is skipped by the update pass
+    gpu_particle_t* slots = calloc(max_particles, sizeof(gpu_particle_t));
+    assert(slots);
+
+    g->particles_buf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.storage_buffer = true,
+        .data = { .ptr = slots, .size = max_particles * sizeof(gpu_particle_t) },
+        .label = "gpu-sim-particles"
+    });
+    free(slots);
+
+    g->spawns_buf = sg_make_buffer(&(sg_buffer_desc){
+        .usage = { .storage_buffer = true, .stream_update = true },
+        .size = max_particles * sizeof(gpu_particle_t),
+        .label = "gpu-sim-spawns"
+    });
+
+    // the curves are baked once on the cpu and shared with the reference path
+    gpu_lut_entry_t lut[PARTICLES_LUT_SIZE];
+    gpu_sim_pack_lut(p, lut);
+
+    g->lut_buf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.storage_buffer = true,
+        .data = SG_RANGE(lut),
+        .label = "gpu-sim-lut"
+    });
+
+    g->particles_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = { .buffer = g->particles_buf },
+        .label = "gpu-sim-particles-view"
+    });
+    g->spawns_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = { .buffer = g->spawns_buf },
+        .label = "gpu-sim-spawns-view"
+    });
+    g->lut_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = { .buffer = g->lut_buf },
+        .label = "gpu-sim-lut-view"
+    });
+
+    g->emit_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(gpu_emit_shader_desc(sg_query_backend())),
+        .label = "gpu-sim-emit-pipeline"
+    });
+
+    g->update_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(gpu_update_shader_desc(sg_query_backend())),
+        .label = "gpu-sim-update-pipeline"
+    });
+
+    // same render state as the instanced cpu path, but the per-instance
+    // data is pulled from the particle storage buffer in the vertex shader
+    sg_pipeline_desc render_desc = {
+        .layout = {
+            .attrs = {
+                [ATTR_gpu_render_pos] = {
+                    .format = SG_VERTEXFORMAT_FLOAT3,
+                    .buffer_index = 0, 
+                    .offset = offsetof(vertex_s, pos)
+                },
+                [ATTR_gpu_render_uv0] = {
+                    .format = SG_VERTEXFORMAT_FLOAT2,
+                    .buffer_index = 0, 
+                    .offset = offsetof(vertex_s, uv)
+                }
+            },
+            .buffers[0].stride = sizeof(vertex_s)
+        },
+        .shader = sg_make_shader(gpu_render_shader_desc(sg_query_backend())),
+        .index_type = SG_INDEXTYPE_UINT16,
+        .cull_mode = SG_CULLMODE_BACK,
+        .face_winding = SG_FACEWINDING_CCW,
+        .depth = {
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = false,
+        },
+        .colors[0] = {
+            .blend = {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .src_factor_alpha = SG_BLENDFACTOR_ONE,
+                .dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .op_rgb = SG_BLENDOP_ADD,
+                .op_alpha = SG_BLENDOP_ADD,
+            }
+        },
+        .label = "gpu-sim-render-pipeline"
+    };
+    g->render_pip = sg_make_pipeline(&render_desc);
+
+    // the same pipeline for a single sampled RGBA8 target without depth,
+    // the reduced resolution particle pass
+    render_desc.sample_count = 1;
+    render_desc.colors[0].pixel_format = SG_PIXELFORMAT_RGBA8;
+    render_desc.depth.pixel_format = SG_PIXELFORMAT_NONE;
+    render_desc.depth.compare = SG_COMPAREFUNC_ALWAYS;
+    render_desc.label = "gpu-sim-offscreen-render-pipeline";
+    g->offscreen_render_pip = sg_make_pipeline(&render_desc);
+
+    g->render_bind = (sg_bindings){
+        .vertex_buffers[0] = desc->geometry_vertices,
+        .index_buffer = desc->geometry_indices,
+        .views = {
+            [VIEW_vs_particles] = g->particles_view,
+            [VIEW_gpu_tex] = desc->texture_view
+        },
+        .samplers[SMP_gpu_smp] = desc->sampler
+    };
+}
+
+/*
+ * @brief Destroys the gpu resources and frees the staging memory
+ *
+ * @param g Pointer to the gpu simulation structure to deinitialize
+ */
+void gpu_sim_deinit(gpu_sim_s* g) {
+    if (g) {
+        sg_destroy_pipeline(g->offscreen_render_pip);
+        sg_destroy_pipeline(g->render_pip);
+        sg_destroy_pipeline(g->update_pip);
+        sg_destroy_pipeline(g->emit_pip);
+        sg_destroy_view(g->lut_view);
+        sg_destroy_view(g->spawns_view);
+        sg_destroy_view(g->particles_view);
+        sg_destroy_buffer(g->lut_buf);
+        sg_destroy_buffer(g->spawns_buf);
+        sg_destroy_buffer(g->particles_buf);
+        free(g->spawns);
+        free(g->expiries);
+        free(g->free_slots);
+        *g = (gpu_sim_s){ };
+    }
+}
+
+/*
+ * @brief Moves the particles spawned on the emitter to the gpu and runs
+ * the update and emit compute passes
+ *
+ * The emitter's particles are only used as staging for new spawns here,
+ * only those are uploaded, the simulated state never leaves the gpu.
+ *
+ * Each spawn gets a free slot. The cpu knows the remaining lifetime of
+ * every spawn, so it tracks when the slots run out without a readback.
+ * A slot is only reused GPU_SIM_REUSE_MARGIN seconds after its particle
+ * expired, which covers the rounding differences of the summed frame
+ * times. The emitter's spawn_limit is lowered to the free slots, so
+ * emission stops at capacity as it does on the C path instead of
+ * overwriting live particles.
+ *
+ * @param g Pointer to the gpu simulation structure
+ * @param e Pointer to the emitter the particles were spawned with
+ * @param dt Time delta in seconds
+ */
+void gpu_sim_update(gpu_sim_s* g, emitter_s* e, float dt) {
+    assert(g && e && dt >= 0.0f);
+    assert(e->max_particles == g->max_particles);
+
+    particles_s* p = &e->particles;
+    gpu_particle_t* spawns = g->spawns;
+    const size_t num_spawns = p->num_particles;
+    assert(num_spawns <= g->num_free);
+
+    // spawns are already advanced to the end of this frame
+    g->time += dt;
+
+    for (size_t i = 0; i < num_spawns; i++) {
+        const uint32_t slot = g->free_slots[--g->num_free];
+        expiry_push(g, (gpu_slot_expiry_s){ 
+            .time = g->time + p->lifetimes[i], 
+            .slot = slot 
+        });
+
+        spawns[i] = gpu_sim_pack_particle(p, i, slot);
+    }
+    p->num_particles = 0;
+
+    // slots whose particle ran out at least the margin ago can be reused
+    while (g->num_occupied > 0 && 
+           g->expiries[0].time + GPU_SIM_REUSE_MARGIN <= g->time) {
+        g->free_slots[g->num_free++] = expiry_pop(g);
+    }
+    e->spawn_limit = g->num_free;
+
+    if (num_spawns > 0) {
+        sg_update_buffer(g->spawns_buf, &(sg_range){
+            .ptr = spawns,
+            .size = num_spawns * sizeof(gpu_particle_t)
+        });
+    }
+
+    sg_begin_pass(&(sg_pass){ .compute = true, .label = "gpu-sim-pass" });
+
+    // the update runs first, spawns are already advanced to the end of the frame
+    const cs_update_params_t update_params = { .dt = dt };
+
+    sg_apply_pipeline(g->update_pip);
+    sg_apply_bindings(&(sg_bindings){
+        .views = {
+            [VIEW_cs_particles] = g->particles_view,
+            [VIEW_cs_lut] = g->lut_view
+        }
+    });
+    sg_apply_uniforms(UB_cs_update_params, &SG_RANGE(update_params));
+    sg_dispatch(group_count(g->max_particles), 1, 1);
+
+    if (num_spawns > 0) {
+        const cs_emit_params_t emit_params = {
+            .num_spawns = (int32_t)num_spawns
+        };
+
+        sg_apply_pipeline(g->emit_pip);
+        sg_apply_bindings(&(sg_bindings){
+            .views = {
+                [VIEW_cs_particles] = g->particles_view,
+                [VIEW_cs_spawns] = g->spawns_view
+            }
+        });
+        sg_apply_uniforms(UB_cs_emit_params, &SG_RANGE(emit_params));
+        sg_dispatch(group_count(num_spawns), 1, 1);
+    }
+
+    sg_end_pass();
+}
+
+/*
+ * @brief Draws all particle slots, dead slots collapse to zero sized quads
+ *
+ * @param g Pointer to the gpu simulation structure
+ * @param model Model matrix
+ * @param view View matrix
+ * @param proj Projection matrix
+ * @param offscreen Draw into a single sampled RGBA8 target without depth
+ *
+ * @note Must be called inside a render pass
+ */
+void gpu_sim_draw(const gpu_sim_s* g, mat4s model, mat4s view, mat4s proj, bool offscreen) {
+    assert(g);
+
+    gpu_vs_params_t vs_params;
+    memcpy(vs_params.model, model.raw, sizeof(mat4s));
+    memcpy(vs_params.view, view.raw, sizeof(mat4s));
+    memcpy(vs_params.proj, proj.raw, sizeof(mat4s));
+
+    sg_apply_pipeline(offscreen ? g->offscreen_render_pip : g->render_pip);
+    sg_apply_bindings(&g->render_bind);
+    sg_apply_uniforms(UB_gpu_vs_params, &SG_RANGE(vs_params));
+    sg_draw(0, g->num_geometry_indices, g->max_particles);
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "sokol_gfx.h"
+
+#include "cglm/struct.h"
+#include "particles.h"
+
+#include "gpu_particles.glsl.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+typedef struct gpu_slot_expiry {
+    double time; // simulated time the particle in the slot runs out
+    uint32_t slot;
+} gpu_slot_expiry_s;
+
+typedef struct gpu_sim {
+    size_t max_particles;
+    size_t num_geometry_indices;
+
+    // slot bookkeeping on the cpu, the gpu state is never read back
+    double time;
+    uint32_t* free_slots; // stack of slots without a living particle
+    size_t num_free;
+    gpu_slot_expiry_s* expiries; // min-heap of the occupied slots
+    size_t num_occupied;
+
+    void* spawns; // staging memory for the particles spawned this frame
+
+    sg_buffer particles_buf;
+    sg_buffer spawns_buf;
+    sg_buffer lut_buf;
+    sg_view particles_view;
+    sg_view spawns_view;
+    sg_view lut_view;
+
+    sg_pipeline emit_pip;
+    sg_pipeline update_pip;
+    sg_pipeline render_pip;
+    sg_pipeline offscreen_render_pip;
+    sg_bindings render_bind;
+} gpu_sim_s;
+
+typedef struct gpu_sim_desc {
+    const emitter_s* emitter; // provides the capacity and the baked curves
+
+    sg_buffer geometry_vertices;
+    sg_buffer geometry_indices;
+    size_t num_geometry_indices;
+    sg_view texture_view;
+    sg_sampler sampler;
+} gpu_sim_desc_s;
+
+/*
+ * @brief Packs the baked curves into the layout of the lookup table buffer
+ *
+ * @param p Pointer to the particles structure with the baked curves
+ * @param lut Output, PARTICLES_LUT_SIZE entries
+ */
+static inline void gpu_sim_pack_lut(const particles_s* p, gpu_lut_entry_t* lut) {
+    for (size_t i = 0; i < PARTICLES_LUT_SIZE; i++) {
+        lut[i] = (gpu_lut_entry_t){
+            .color = {
+                p->color_lut[i].r, p->color_lut[i].g, 
+                p->color_lut[i].b, p->color_lut[i].a
+            },
+            .size = p->size_lut[i]
+        };
+    }
+}
+
+/*
+ * @brief Packs a particle into the layout of the particle buffer
+ *
+ * @param p Pointer to the particles structure
+ * @param i Index of the particle
+ * @param slot Slot of the particle buffer the particle goes to
+ *
+ * @returns The packed particle
+ */
+static inline gpu_particle_t gpu_sim_pack_particle(const particles_s* p, size_t i, uint32_t slot) {
+    return (gpu_particle_t){
+        .pos = { p->positions[i].x, p->positions[i].y, p->positions[i].z },
+        .lifetime = p->lifetimes[i],
+        .vel = { p->velocities[i].x, p->velocities[i].y, p->velocities[i].z },
+        .inv_lifetime = p->inv_lifetimes[i],
+        .color = { p->colors[i].r, p->colors[i].g, p->colors[i].b, p->colors[i].a },
+        .size = p->sizes[i],
+        .slot = (int32_t)slot
+    };
+}
+
+bool gpu_sim_supported(void);
+void gpu_sim_init(gpu_sim_s* g, const gpu_sim_desc_s* desc);
+void gpu_sim_deinit(gpu_sim_s* g);
+void gpu_sim_update(gpu_sim_s* g, emitter_s* e, float dt);
+void gpu_sim_draw(const gpu_sim_s* g, mat4s model, mat4s view, mat4s proj, bool offscreen);
@@ -0,0 +1,39 @@
+// Body of the particle update kernel, one particle per invocation.
+//
+// Included by gpu_update_cs in gpu_particles.glsl and by the headless
+// check in bench/kernel_check.c, so the check runs the same source as the
+// gpu. Written in the common subset of GLSL and C: per component loops
+// instead of vector operations and float literals. The includer defines
+// KERNEL_PRECISE, KERNEL_INT() and KERNEL_FLOAT() and provides prt, lut,
+// lut_length, i and dt.
+
+if (prt[i].lifetime <= 0.0f) {
+    return;
+}
+
+// same operations as particles_update(), precise keeps the driver from
+// fusing them so the cpu path stays a bit exact reference
+KERNEL_PRECISE float lifetime = prt[i].lifetime - dt;
+if (lifetime <= 0.0f) {
+    // dead slots collapse to a zero sized quad until they are reused
+    prt[i].lifetime = 0.0f;
+    prt[i].size = 0.0f;
+    return;
+}
+
+for (int k = 0; k < 3; k++) {
+    KERNEL_PRECISE float step = prt[i].vel[k] * dt;
+    KERNEL_PRECISE float pos = prt[i].pos[k] + step;
+    prt[i].pos[k] = pos;
+}
+
+KERNEL_PRECISE float age = 1.0f - lifetime * prt[i].inv_lifetime;
+KERNEL_PRECISE float clamped = age < 0.0f ? 0.0f : (age > 1.0f ? 1.0f : age);
+KERNEL_PRECISE float lut_pos = clamped * KERNEL_FLOAT(lut_length - 1) + 0.5f;
+int idx = KERNEL_INT(lut_pos);
+
+prt[i].lifetime = lifetime;
+for (int k = 0; k < 4; k++) {
+    prt[i].color[k] = lut[idx].color[k];
+}
+prt[i].size = lut[idx].size;
@@ -9,6 +9,7 @@ in vec3 pos;
 
 in vec3 inst_pos;
 in vec4 inst_color;
+in float inst_size;
 
 in vec2 uv0;
 
@@ -20,8 +21,7 @@ void main() {
     vec3 cam_up = vec3(view[0][1], view[1][1], view[2][1]);
 
     vec3 world_pos = inst_pos 
-        + pos.x * cam_right 
-        + pos.y * cam_up;
+        + inst_size * (pos.x * cam_right + pos.y * cam_up);
 
     gl_Position = proj * view * model * vec4(world_pos, 1.0f);
 
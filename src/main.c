@@ -4,11 +4,25 @@
  * Spawns particles in a fixed time interval. If SPACE is pressed, a batch of
  * particles is emitted.
  *
+ * The simulation runs in compute shaders when the backend supports them,
+ * otherwise (or when started with --cpu) the C reference path is used.
+ *
+ * On the C path T toggles ribbons drawn along the particle trails, the gpu
+ * path records no history and ignores the key. Started with --lockstep the
+ * C path steps with a fixed time and a fixed seed, so every run produces
+ * the same particles.
+ *
+ * The billboards are octagons fitted to the texture so the transparent
+ * corners are not shaded. H renders the particles into an offscreen target
+ * at half the window resolution, which is upsampled and blended over the
+ * frame, trading sharpness for a quarter of the fill rate.
+ *
  */
 
 
 #include <string.h>
 #include <stdlib.h>
+#include <assert.h>
 #include <time.h>
 
 #define SOKOL_IMPL
@@ -21,11 +35,21 @@
 
 #include "cglm/struct.h"
 
+#include "demo.h"
 #include "particles.h"
+#include "gpu_sim.h"
+#include "ribbon.h"
 #include "quad.h"
 #include "texture.h"
 
+#include "composite.glsl.h"
 #include "instancing.glsl.h"
+#include "ribbon.glsl.h"
+
+#define LOCKSTEP_DT (1.0f / 60.0f)
+#define TRAIL_LENGTH 16
+#define RIBBON_HALF_WIDTH 0.02f
+#define NUM_GEOMETRY_INDICES (sizeof(octagon_indices) / sizeof(octagon_indices[0]))
 
 
 static struct {
@@ -34,22 +58,126 @@ static struct {
     sg_bindings bind;
 
     emitter_s emitter;
+
+    sg_pipeline ribbon_pip;
+    sg_bindings ribbon_bind;
+    ribbon_vertex_s* ribbon_vertices;
+    bool show_ribbons;
+
+    // reduced resolution particle pass, recreated when the window size changes
+    sg_pass_action offscreen_pass_action;
+    sg_pipeline offscreen_pip;
+    sg_image offscreen_img;
+    sg_view offscreen_color_view;
+    sg_view offscreen_texture_view;
+    int offscreen_width;
+    int offscreen_height;
+    sg_pipeline composite_pip;
+    sg_bindings composite_bind;
+    bool half_res;
+
+    bool force_cpu;
+    bool lockstep;
+    bool use_gpu;
+    gpu_sim_s gpu;
 } state;
 
-static float frand_range(float min, float max) {
-    const float r = (float)rand() / (float)RAND_MAX;
-    return min + r * (max - min);
+/*
+ * @brief (Re)creates the offscreen target at half the window resolution
+ */
+static void create_offscreen(void) {
+    if (state.offscreen_img.id != SG_INVALID_ID) {
+        sg_destroy_view(state.offscreen_texture_view);
+        sg_destroy_view(state.offscreen_color_view);
+        sg_destroy_image(state.offscreen_img);
+    }
+
+    state.offscreen_width = glm_imax(sapp_width() / 2, 1);
+    state.offscreen_height = glm_imax(sapp_height() / 2, 1);
+
+    state.offscreen_img = sg_make_image(&(sg_image_desc){
+        .usage.color_attachment = true,
+        .width = state.offscreen_width,
+        .height = state.offscreen_height,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .sample_count = 1,
+        .label = "offscreen-image"
+    });
+    state.offscreen_color_view = sg_make_view(&(sg_view_desc){
+        .color_attachment = { .image = state.offscreen_img },
+        .label = "offscreen-color-view"
+    });
+    state.offscreen_texture_view = sg_make_view(&(sg_view_desc){
+        .texture = { .image = state.offscreen_img },
+        .label = "offscreen-texture-view"
+    });
+    state.composite_bind.views[VIEW_composite_tex] = state.offscreen_texture_view;
 }
 
-static void emit_particle(emitter_s* e) {
-    emitter_add_particle(e, &(particle_desc_s){
-        .position = (vec3s){ },
-        .velocity = (vec3s){ 
-            .x = frand_range(-0.5f, 0.5f), 
-            .y = frand_range(1.0f, 3.0f), 
-            .z = frand_range(-0.5f, 0.5f) 
+/*
+ * @brief Creates the ribbon buffers and pipeline, only the C path keeps trails
+ *
+ * The topology is fixed so the indices are static.
+ */
+static void create_ribbons(void) {
+    const size_t num_ribbon_indices = 
+        state.emitter.max_particles * RIBBON_INDICES_PER_PARTICLE(TRAIL_LENGTH);
+    const size_t num_ribbon_vertices = 
+        state.emitter.max_particles * RIBBON_VERTICES_PER_PARTICLE(TRAIL_LENGTH);
+
+    uint32_t* ribbon_indices = malloc(num_ribbon_indices * sizeof(uint32_t));
+    assert(ribbon_indices);
+    ribbon_build_indices(state.emitter.max_particles, TRAIL_LENGTH, ribbon_indices);
+
+    state.ribbon_bind.index_buffer = sg_make_buffer(&(sg_buffer_desc){
+        .usage.index_buffer = true,
+        .data = { .ptr = ribbon_indices, .size = num_ribbon_indices * sizeof(uint32_t) },
+        .label = "ribbon-indices"
+    });
+    free(ribbon_indices);
+
+    state.ribbon_vertices = malloc(num_ribbon_vertices * sizeof(ribbon_vertex_s));
+    assert(state.ribbon_vertices);
+
+    state.ribbon_bind.vertex_buffers[0] = sg_make_buffer(&(sg_buffer_desc){
+        .size = num_ribbon_vertices * sizeof(ribbon_vertex_s),
+        .usage.stream_update = true,
+        .label = "ribbon-vertices"
+    });
+
+    state.ribbon_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout = {
+            .attrs = {
+                [ATTR_ribbon_pos] = {
+                    .format = SG_VERTEXFORMAT_FLOAT3,
+                    .offset = offsetof(ribbon_vertex_s, pos)
+                },
+                [ATTR_ribbon_color0] = {
+                    .format = SG_VERTEXFORMAT_FLOAT4,
+                    .offset = offsetof(ribbon_vertex_s, color)
+                }
+            },
+            .buffers[0].stride = sizeof(ribbon_vertex_s)
+        },
+        .shader = sg_make_shader(ribbon_shader_desc(sg_query_backend())),
+        .index_type = SG_INDEXTYPE_UINT32,
+        .cull_mode = SG_CULLMODE_NONE,
+        .depth = {
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = false,
+        },
+        .colors[0] = {
+            .blend = {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .src_factor_alpha = SG_BLENDFACTOR_ONE,
+                .dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .op_rgb = SG_BLENDOP_ADD,
+                .op_alpha = SG_BLENDOP_ADD,
+            }
         },
-        .lifetime = frand_range(1.0f, 5.0f)
+        .label = "ribbon-pipeline"
     });
 }
 
@@ -59,17 +187,22 @@ static void init(void) {
         .logger.func = slog_func,
     });
 
-    // seed random number generator
-    srand((unsigned int)time(nullptr));
+    // the backend decides the layout, the gpu path keeps no trail history
+    state.use_gpu = !state.force_cpu && gpu_sim_supported();
 
     // initialize the emitter
     emitter_init(&state.emitter, &(emitter_desc_s){
-        .emission_rate = 50.0f,
-        .emit = emit_particle, 
+        .emission_rate = DEMO_EMISSION_RATE,
+        .emit = demo_emit_particle, 
+        .fixed_dt = state.lockstep ? LOCKSTEP_DT : 0.0f,
+        .seed = state.lockstep ? 1 : (uint64_t)time(nullptr),
         .particles_desc = &(particles_desc_s){
-            .max_particles = 1024,
-            .start_color = (vec4s){ .r = 1.0f, .g = 0.5f, .b = 0.0f, .a = 1.0f },
-            .end_color = (vec4s){ .r = 1.0f, .g = 0.0f, .b = 0.0f, .a = 0.0f }
+            .max_particles = DEMO_MAX_PARTICLES,
+            .color_stops = demo_color_stops,
+            .num_color_stops = DEMO_NUM_COLOR_STOPS,
+            .size_stops = demo_size_stops,
+            .num_size_stops = DEMO_NUM_SIZE_STOPS,
+            .trail_length = state.use_gpu ? 0 : TRAIL_LENGTH
         }
     });
 
@@ -83,18 +216,18 @@ static void init(void) {
 
     // vertex buffer for static geometry, goes into vertex-buffer-slot 0
     state.bind.vertex_buffers[0] = sg_make_buffer(&(sg_buffer_desc){
-        .data = SG_RANGE(quad_vertices), 
+        .data = SG_RANGE(octagon_vertices), 
         .label = "geometry-vertices"
     });
 
     // index buffer for static geometry
     state.bind.index_buffer = sg_make_buffer(&(sg_buffer_desc){
         .usage.index_buffer = true,
-        .data = SG_RANGE(quad_indices),
+        .data = SG_RANGE(octagon_indices),
         .label = "geometry-indices"
     });
 
-    // empty, dynamic instance-data vertex buffer, goes into vertex-buffer-slot 1 and 2
+    // empty, dynamic instance-data vertex buffer, goes into vertex-buffer-slot 1, 2 and 3
     state.bind.vertex_buffers[1] = sg_make_buffer(&(sg_buffer_desc){
         .size = state.emitter.max_particles * sizeof(vec3s),
         .usage.stream_update = true,
@@ -107,6 +240,12 @@ static void init(void) {
         .label = "instance-color-data"
     });
 
+    state.bind.vertex_buffers[3] = sg_make_buffer(&(sg_buffer_desc){
+        .size = state.emitter.max_particles * sizeof(float),
+        .usage.stream_update = true,
+        .label = "instance-size-data"
+    });
+
     // a texture for the particles
     sg_image img = sg_make_image(&(sg_image_desc){
         .width = TEXTURE_WIDTH,
@@ -128,8 +267,8 @@ static void init(void) {
     sg_shader shd = sg_make_shader(instancing_shader_desc(sg_query_backend()));
 
     // a pipeline object
-    state.pip = sg_make_pipeline(&(sg_pipeline_desc){
-        // vertex buffer at slot 1 and 2 must step per instance
+    sg_pipeline_desc pip_desc = {
+        // vertex buffer at slot 1, 2 and 3 must step per instance
         .layout = {
             .attrs = {
                 [ATTR_instancing_pos] = {
@@ -149,11 +288,16 @@ static void init(void) {
                 [ATTR_instancing_inst_color] = {
                     .format = SG_VERTEXFORMAT_FLOAT4,
                     .buffer_index = 2
+                },
+                [ATTR_instancing_inst_size] = {
+                    .format = SG_VERTEXFORMAT_FLOAT,
+                    .buffer_index = 3
                 }
             },
             .buffers[0].stride = sizeof(vertex_s), 
             .buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE,
             .buffers[2].step_func = SG_VERTEXSTEP_PER_INSTANCE,
+            .buffers[3].step_func = SG_VERTEXSTEP_PER_INSTANCE,
         },
         .shader = shd,
         .index_type = SG_INDEXTYPE_UINT16,
@@ -175,20 +319,88 @@ static void init(void) {
             }
         },
         .label = "instancing-pipeline"
+    };
+    state.pip = sg_make_pipeline(&pip_desc);
+
+    // the same pipeline for the half resolution target, which has no depth
+    // buffer and no multisampling
+    pip_desc.sample_count = 1;
+    pip_desc.colors[0].pixel_format = SG_PIXELFORMAT_RGBA8;
+    pip_desc.depth.pixel_format = SG_PIXELFORMAT_NONE;
+    pip_desc.depth.compare = SG_COMPAREFUNC_ALWAYS;
+    pip_desc.label = "offscreen-instancing-pipeline";
+    state.offscreen_pip = sg_make_pipeline(&pip_desc);
+
+    // the offscreen target starts out transparent and accumulates
+    // premultiplied color, alpha is the coverage of the particles
+    state.offscreen_pass_action = (sg_pass_action){
+        .colors[0] = {
+            .load_action = SG_LOADACTION_CLEAR,
+            .clear_value = { 0.0f, 0.0f, 0.0f, 0.0f }
+        }
+    };
+
+    // upsamples the offscreen target over the frame
+    state.composite_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = sg_make_shader(composite_shader_desc(sg_query_backend())),
+        .depth = {
+            .compare = SG_COMPAREFUNC_ALWAYS,
+            .write_enabled = false,
+        },
+        .colors[0] = {
+            .blend = {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_ONE,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .src_factor_alpha = SG_BLENDFACTOR_ONE,
+                .dst_factor_alpha = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .op_rgb = SG_BLENDOP_ADD,
+                .op_alpha = SG_BLENDOP_ADD,
+            }
+        },
+        .label = "composite-pipeline"
     });
+
+    state.composite_bind.samplers[SMP_composite_smp] = sg_make_sampler(&(sg_sampler_desc){
+        .min_filter = SG_FILTER_LINEAR,
+        .mag_filter = SG_FILTER_LINEAR,
+        .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+        .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+        .label = "composite-sampler"
+    });
+
+    // the gpu simulation shares the geometry and texture with the cpu path
+    if (state.use_gpu) {
+        gpu_sim_init(&state.gpu, &(gpu_sim_desc_s){
+            .emitter = &state.emitter,
+            .geometry_vertices = state.bind.vertex_buffers[0],
+            .geometry_indices = state.bind.index_buffer,
+            .num_geometry_indices = NUM_GEOMETRY_INDICES,
+            .texture_view = state.bind.views[VIEW_tex],
+            .sampler = state.bind.samplers[SMP_smp]
+        });
+    } else {
+        create_ribbons();
+    }
 }
 
 static void frame(void) {
     const float dt = (float)(sapp_frame_duration());
 
-    // emit new particles
-    emitter_emit_timed(&state.emitter, dt);
+    if (state.use_gpu) {
+        // emit new particles, they are already advanced to the end of the frame
+        emitter_emit_timed(&state.emitter, dt);
 
-    // update emitter (which updates the particles)
-    emitter_update(&state.emitter, dt);
+        // upload only the new particles and simulate on the gpu
+        gpu_sim_update(&state.gpu, &state.emitter, dt);
+    } else {
+        // update the particles and emit new ones, in lockstep mode only
+        // whole steps of LOCKSTEP_DT are taken
+        emitter_advance(&state.emitter, dt);
+    }
 
     // update instance data
-    if (state.emitter.particles.num_particles > 0) {
+    if (!state.use_gpu && state.emitter.particles.num_particles > 0) {
         sg_update_buffer(state.bind.vertex_buffers[1], &(sg_range){
             .ptr = state.emitter.particles.positions,
             .size = state.emitter.particles.num_particles * sizeof(vec3s)
@@ -198,6 +410,11 @@ static void frame(void) {
             .ptr = state.emitter.particles.colors,
             .size = state.emitter.particles.num_particles * sizeof(vec4s)
         });
+
+        sg_update_buffer(state.bind.vertex_buffers[3], &(sg_range){
+            .ptr = state.emitter.particles.sizes,
+            .size = state.emitter.particles.num_particles * sizeof(float)
+        });
     }
 
     // model-view-projection matrix
@@ -211,8 +428,9 @@ static void frame(void) {
     const float radius = 5.0f;
     const float cam_x = sinf(sapp_frame_count() * 0.05f) * radius;
     const float cam_z = cosf(sapp_frame_count() * 0.05f) * radius;
+    const vec3s eye = { .x = cam_x, .y = 1.5f, .z = cam_z };
     const mat4s view = glms_lookat(
-        (vec3s){ .x = cam_x, .y = 1.5f, .z = cam_z },
+        eye,
         (vec3s){ .x = 0.0f, .y = 0.0f, .z = 0.0f },
         (vec3s){ .x = 0.0f, .y = 1.0f, .z = 0.0f }
     );
@@ -222,20 +440,83 @@ static void frame(void) {
     memcpy(&vs_params.view, view.raw, sizeof(mat4s));
     memcpy(&vs_params.proj, proj.raw, sizeof(mat4s));
 
+    // trail history is only recorded by the C path
+    const bool draw_ribbons = state.show_ribbons && !state.use_gpu &&
+        state.emitter.particles.num_particles > 0;
+    if (draw_ribbons) {
+        const size_t num_vertices = ribbon_build_vertices(
+            &state.emitter.particles, eye, RIBBON_HALF_WIDTH, state.ribbon_vertices
+        );
+        sg_update_buffer(state.ribbon_bind.vertex_buffers[0], &(sg_range){
+            .ptr = state.ribbon_vertices,
+            .size = num_vertices * sizeof(ribbon_vertex_s)
+        });
+    }
+
+    // render the particles into the half resolution target first
+    const bool draw_offscreen = state.half_res;
+    if (draw_offscreen) {
+        if (state.offscreen_width != glm_imax(sapp_width() / 2, 1) ||
+            state.offscreen_height != glm_imax(sapp_height() / 2, 1)) {
+            create_offscreen();
+        }
+
+        sg_begin_pass(&(sg_pass){
+            .action = state.offscreen_pass_action,
+            .attachments.colors[0] = state.offscreen_color_view
+        });
+        if (state.use_gpu) {
+            gpu_sim_draw(&state.gpu, glms_mat4_identity(), view, proj, true);
+        } else {
+            sg_apply_pipeline(state.offscreen_pip);
+            sg_apply_bindings(&state.bind);
+            sg_apply_uniforms(UB_vs_params, &SG_RANGE(vs_params));
+            sg_draw(0, NUM_GEOMETRY_INDICES, state.emitter.particles.num_particles);
+        }
+        sg_end_pass();
+    }
+
     // ...and draw
     sg_begin_pass(&(sg_pass){
         .action = state.pass_action,
         .swapchain = sglue_swapchain()
     });
-    sg_apply_pipeline(state.pip);
-    sg_apply_bindings(&state.bind);
-    sg_apply_uniforms(UB_vs_params, &SG_RANGE(vs_params));
-    sg_draw(0, 6, state.emitter.particles.num_particles);
+    if (draw_ribbons) {
+        ribbon_vs_params_t ribbon_vs_params;
+        memcpy(&ribbon_vs_params.model, glms_mat4_identity().raw, sizeof(mat4s)); 
+        memcpy(&ribbon_vs_params.view, view.raw, sizeof(mat4s));
+        memcpy(&ribbon_vs_params.proj, proj.raw, sizeof(mat4s));
+
+        sg_apply_pipeline(state.ribbon_pip);
+        sg_apply_bindings(&state.ribbon_bind);
+        sg_apply_uniforms(UB_ribbon_vs_params, &SG_RANGE(ribbon_vs_params));
+        sg_draw(0, 
+            state.emitter.particles.num_particles * RIBBON_INDICES_PER_PARTICLE(TRAIL_LENGTH), 
+            1
+        );
+    }
+
+    if (draw_offscreen) {
+        sg_apply_pipeline(state.composite_pip);
+        sg_apply_bindings(&state.composite_bind);
+        sg_draw(0, 3, 1);
+    } else if (state.use_gpu) {
+        gpu_sim_draw(&state.gpu, glms_mat4_identity(), view, proj, false);
+    } else {
+        sg_apply_pipeline(state.pip);
+        sg_apply_bindings(&state.bind);
+        sg_apply_uniforms(UB_vs_params, &SG_RANGE(vs_params));
+        sg_draw(0, NUM_GEOMETRY_INDICES, state.emitter.particles.num_particles);
+    }
     sg_end_pass();
     sg_commit();
 }
 
 static void cleanup(void) { 
+    if (state.use_gpu) {
+        gpu_sim_deinit(&state.gpu);
+    }
+    free(state.ribbon_vertices);
     emitter_deinit(&state.emitter);
     sg_shutdown(); 
 }
@@ -249,6 +530,18 @@ static void event(const sapp_event *e) {
             case SAPP_KEYCODE_SPACE:
                 emitter_emit_batch(&state.emitter, 100);
                 break;
+            case SAPP_KEYCODE_T:
+                // the gpu simulation keeps no trail history to draw
+                if (state.use_gpu) {
+                    slog_func("particles", 2, 0, "ribbons need the C path, start with --cpu", 
+                        __LINE__, __FILE__, nullptr);
+                    break;
+                }
+                state.show_ribbons = !state.show_ribbons;
+                break;
+            case SAPP_KEYCODE_H:
+                state.half_res = !state.half_res;
+                break;
             default:
                 break;
         }
@@ -256,8 +549,15 @@ static void event(const sapp_event *e) {
 }
 
 sapp_desc sokol_main(int argc, char *argv[]) {
-    (void)argc;
-    (void)argv;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--cpu") == 0) {
+            state.force_cpu = true;
+        } else if (strcmp(argv[i], "--lockstep") == 0) {
+            state.lockstep = true;
+            state.force_cpu = true;
+        }
+    }
+
     return (sapp_desc){
         .init_cb = init,
         .frame_cb = frame,
@@ -0,0 +1,197 @@
+#include "overdraw.h"
+
+#include "texture.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+typedef struct screen_vertex {
+    float x, y;    // pixel coordinates, y pointing down
+    float inv_w;   // for perspective correct interpolation
+    float u, v;    // texture coordinates divided by w
+} screen_vertex_s;
+
+static float edge(const screen_vertex_s* a, const screen_vertex_s* b, float x, float y) {
+    return (x - a->x) * (b->y - a->y) - (y - a->y) * (b->x - a->x);
+}
+
+/*
+ * @brief Fill convention for pixel centers exactly on an edge
+ *
+ * Only the top and left edges own such pixels, so triangles sharing an edge
+ * do not shade it twice, the same rule the hardware applies.
+ */
+static bool is_top_left(const screen_vertex_s* a, const screen_vertex_s* b) {
+    const float dx = b->x - a->x;
+    const float dy = b->y - a->y;
+    return (dy == 0.0f && dx < 0.0f) || dy > 0.0f;
+}
+
+static bool texel_is_transparent(float u, float v) {
+    const int x = glm_imin(glm_imax((int)(u * TEXTURE_WIDTH), 0), TEXTURE_WIDTH - 1);
+    const int y = glm_imin(glm_imax((int)(v * TEXTURE_HEIGHT), 0), TEXTURE_HEIGHT - 1);
+
+    // ARGB texels, alpha is the top byte
+    return (texture[y * TEXTURE_WIDTH + x] >> 24) == 0;
+}
+
+static void rasterize(overdraw_s* o, overdraw_stats_s* stats, screen_vertex_s v0, screen_vertex_s v1, screen_vertex_s v2) {
+    float area = edge(&v0, &v1, v2.x, v2.y);
+    if (area == 0.0f) {
+        return;
+    }
+
+    // billboards always face the camera, bring both windings into one order
+    if (area < 0.0f) {
+        const screen_vertex_s tmp = v1;
+        v1 = v2;
+        v2 = tmp;
+    }
+
+    // clamp in float first, billboards close to the camera can be huge
+    const float max_xf = (float)(o->width - 1);
+    const float max_yf = (float)(o->height - 1);
+    const int min_x = (int)floorf(glm_clamp(glm_min(v0.x, glm_min(v1.x, v2.x)), 0.0f, max_xf));
+    const int min_y = (int)floorf(glm_clamp(glm_min(v0.y, glm_min(v1.y, v2.y)), 0.0f, max_yf));
+    const int max_x = (int)ceilf(glm_clamp(glm_max(v0.x, glm_max(v1.x, v2.x)), 0.0f, max_xf));
+    const int max_y = (int)ceilf(glm_clamp(glm_max(v0.y, glm_max(v1.y, v2.y)), 0.0f, max_yf));
+
+    const bool own0 = is_top_left(&v1, &v2);
+    const bool own1 = is_top_left(&v2, &v0);
+    const bool own2 = is_top_left(&v0, &v1);
+
+    for (int y = min_y; y <= max_y; y++) {
+        for (int x = min_x; x <= max_x; x++) {
+            const float px = (float)x + 0.5f;
+            const float py = (float)y + 0.5f;
+
+            const float w0 = edge(&v1, &v2, px, py);
+            const float w1 = edge(&v2, &v0, px, py);
+            const float w2 = edge(&v0, &v1, px, py);
+
+            if ((w0 < 0.0f || (w0 == 0.0f && !own0)) ||
+                (w1 < 0.0f || (w1 == 0.0f && !own1)) ||
+                (w2 < 0.0f || (w2 == 0.0f && !own2))) {
+                continue;
+            }
+
+            const float inv_w = w0 * v0.inv_w + w1 * v1.inv_w + w2 * v2.inv_w;
+            const float u = (w0 * v0.u + w1 * v1.u + w2 * v2.u) / inv_w;
+            const float v = (w0 * v0.v + w1 * v1.v + w2 * v2.v) / inv_w;
+
+            o->counts[y * o->width + x]++;
+            stats->fragments++;
+            stats->wasted_fragments += texel_is_transparent(u, v);
+        }
+    }
+}
+
+/*
+ * @brief Allocates the per pixel counters for a render target size
+ *
+ * @param o Pointer to the overdraw structure to initialize
+ * @param width Width of the measured render target in pixels
+ * @param height Height of the measured render target in pixels
+ *
+ * @note The caller is responsible for calling overdraw_deinit()
+ */
+void overdraw_init(overdraw_s* o, int width, int height) {
+    assert(o && width > 0 && height > 0);
+
+    *o = (overdraw_s){
+        .width = width,
+        .height = height,
+        .counts = calloc((size_t)width * (size_t)height, sizeof(uint32_t))
+    };
+    assert(o->counts);
+}
+
+/*
+ * @brief Frees the per pixel counters
+ *
+ * @param o Pointer to the overdraw structure to deinitialize
+ */
+void overdraw_deinit(overdraw_s* o) {
+    assert(o);
+
+    free(o->counts);
+    *o = (overdraw_s){ };
+}
+
+/*
+ * @brief Counts the fragments the billboards of all particles would shade
+ *
+ * Software rasterizer without depth test, matching the particle pipeline:
+ * the geometry is expanded with the camera right and up vectors and scaled
+ * by the particle size, fragments are sampled at pixel centers. Fragments
+ * on a zero alpha texel of the particle texture are counted as wasted, they
+ * cost fill rate without changing the image. Triangles reaching behind the
+ * camera are skipped instead of clipped.
+ *
+ * @param o Pointer to the overdraw structure, counts are reset first
+ * @param p Pointer to the particles structure
+ * @param geometry Billboard geometry, in units of the particle size
+ * @param view View matrix
+ * @param proj Projection matrix
+ *
+ * @returns Fragment statistics of the measured frame
+ */
+overdraw_stats_s overdraw_measure(overdraw_s* o, const particles_s* p, const overdraw_geometry_s* geometry, mat4s view, mat4s proj) {
+    assert(o && p && geometry);
+    assert(geometry->num_indices % 3 == 0);
+
+    memset(o->counts, 0, (size_t)o->width * (size_t)o->height * sizeof(uint32_t));
+    overdraw_stats_s stats = { };
+
+    const vec3s cam_right = { .x = view.m00, .y = view.m10, .z = view.m20 };
+    const vec3s cam_up = { .x = view.m01, .y = view.m11, .z = view.m21 };
+    const mat4s view_proj = glms_mat4_mul(proj, view);
+
+    for (size_t i = 0; i < p->num_particles; i++) {
+        for (size_t t = 0; t < geometry->num_indices; t += 3) {
+            screen_vertex_s tri[3];
+            bool visible = true;
+
+            for (size_t k = 0; k < 3; k++) {
+                const vertex_s* vtx = &geometry->vertices[geometry->indices[t + k]];
+
+                const vec3s offset = glms_vec3_add(
+                    glms_vec3_scale(cam_right, vtx->pos.x),
+                    glms_vec3_scale(cam_up, vtx->pos.y)
+                );
+                const vec3s world = glms_vec3_add(p->positions[i], glms_vec3_scale(offset, p->sizes[i]));
+                const vec4s clip = glms_mat4_mulv(view_proj, glms_vec4(world, 1.0f));
+
+                if (clip.w <= 1e-6f) {
+                    visible = false;
+                    break;
+                }
+
+                const float inv_w = 1.0f / clip.w;
+                tri[k] = (screen_vertex_s){
+                    .x = (clip.x * inv_w * 0.5f + 0.5f) * (float)o->width,
+                    .y = (0.5f - clip.y * inv_w * 0.5f) * (float)o->height,
+                    .inv_w = inv_w,
+                    .u = vtx->uv.x * inv_w,
+                    .v = vtx->uv.y * inv_w
+                };
+            }
+
+            if (visible) {
+                rasterize(o, &stats, tri[0], tri[1], tri[2]);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < (size_t)o->width * (size_t)o->height; i++) {
+        stats.covered_pixels += o->counts[i] > 0;
+        if (o->counts[i] > stats.max_overdraw) {
+            stats.max_overdraw = o->counts[i];
+        }
+    }
+
+    return stats;
+}
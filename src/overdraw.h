@@ -0,0 +1,30 @@
+#pragma once
+
+#include "cglm/struct.h"
+#include "particles.h"
+#include "quad.h"
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct overdraw {
+    int width;
+    int height;
+    uint32_t* counts; // fragments per pixel of the last measurement
+} overdraw_s;
+
+typedef struct overdraw_geometry {
+    const vertex_s* vertices;
+    const uint16_t* indices;
+    size_t num_indices;
+} overdraw_geometry_s;
+
+typedef struct overdraw_stats {
+    size_t fragments;        // fragments shaded in total
+    size_t wasted_fragments; // fragments on a zero alpha texel
+    size_t covered_pixels;   // pixels shaded at least once
+    uint32_t max_overdraw;   // most fragments shaded on a single pixel
+} overdraw_stats_s;
+
+void overdraw_init(overdraw_s* o, int width, int height);
+void overdraw_deinit(overdraw_s* o);
+overdraw_stats_s overdraw_measure(overdraw_s* o, const particles_s* p, const overdraw_geometry_s* geometry, mat4s view, mat4s proj);
@@ -1,7 +1,118 @@
 #include "particles.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
+#include <pthread.h>
+
+
+typedef struct lut_segment {
+    size_t from;
+    size_t to;
+    float f; // blend factor from stop from to stop to
+} lut_segment_s;
+
+/*
+ * @brief Finds the stops surrounding a normalized age
+ *
+ * @param stop_t Times of the stops, sorted
+ * @param num_stops Number of stops, must be at least one
+ * @param t Normalized age
+ *
+ * @returns Stops to blend, outside the curve both are the nearest stop
+ */
+static lut_segment_s find_lut_segment(const float* stop_t, size_t num_stops, float t) {
+    assert(stop_t && num_stops > 0);
+
+    if (t <= stop_t[0]) {
+        return (lut_segment_s){ .from = 0, .to = 0, .f = 0.0f };
+    }
+
+    // advance to the segment containing t
+    size_t s = 0;
+    while (s + 1 < num_stops && stop_t[s + 1] < t) {
+        s++;
+    }
+
+    if (s + 1 >= num_stops) {
+        return (lut_segment_s){ .from = num_stops - 1, .to = num_stops - 1, .f = 0.0f };
+    }
+
+    const float span = stop_t[s + 1] - stop_t[s];
+    const float f = span > 0.0f ? (t - stop_t[s]) / span : 1.0f;
+    return (lut_segment_s){ .from = s, .to = s + 1, .f = f };
+}
+
+/*
+ * @brief Bakes color stops into a lookup table over normalized age
+ *
+ * @param lut Lookup table with PARTICLES_LUT_SIZE entries
+ * @param stops Color stops sorted by t
+ * @param num_stops Number of color stops, must be at least one
+ */
+static void bake_color_lut(vec4s* lut, const color_stop_s* stops, size_t num_stops) {
+    assert(lut && stops && num_stops > 0);
+
+    float* stop_t = malloc(num_stops * sizeof(float));
+    assert(stop_t);
+    for (size_t k = 0; k < num_stops; k++) {
+        stop_t[k] = stops[k].t;
+    }
+
+    for (size_t i = 0; i < PARTICLES_LUT_SIZE; i++) {
+        const float t = (float)i / (float)(PARTICLES_LUT_SIZE - 1);
+        const lut_segment_s seg = find_lut_segment(stop_t, num_stops, t);
+        lut[i] = glms_vec4_lerp(stops[seg.from].color, stops[seg.to].color, seg.f);
+    }
+
+    free(stop_t);
+}
+
+/*
+ * @brief Bakes size stops into a lookup table over normalized age
+ *
+ * @param lut Lookup table with PARTICLES_LUT_SIZE entries
+ * @param stops Size stops sorted by t
+ * @param num_stops Number of size stops, must be at least one
+ */
+static void bake_size_lut(float* lut, const size_stop_s* stops, size_t num_stops) {
+    assert(lut && stops && num_stops > 0);
+
+    float* stop_t = malloc(num_stops * sizeof(float));
+    assert(stop_t);
+    for (size_t k = 0; k < num_stops; k++) {
+        stop_t[k] = stops[k].t;
+    }
+
+    for (size_t i = 0; i < PARTICLES_LUT_SIZE; i++) {
+        const float t = (float)i / (float)(PARTICLES_LUT_SIZE - 1);
+        const lut_segment_s seg = find_lut_segment(stop_t, num_stops, t);
+        lut[i] = stops[seg.from].size + seg.f * (stops[seg.to].size - stops[seg.from].size);
+    }
+
+    free(stop_t);
+}
+
+/*
+ * @brief Rounds a size up to a multiple of the cache line size
+ *
+ * @param size Size in bytes
+ */
+static inline size_t align_to_cache_line(size_t size) {
+    return (size + PARTICLES_CACHE_LINE - 1) / PARTICLES_CACHE_LINE * PARTICLES_CACHE_LINE;
+}
+
+/*
+ * @brief Maps a normalized age to the nearest lookup table entry
+ *
+ * @param age Normalized age in [0, 1]
+ *
+ * @returns Index into a table with PARTICLES_LUT_SIZE entries
+ */
+static inline size_t lut_index(float age) {
+    age = age < 0.0f ? 0.0f : (age > 1.0f ? 1.0f : age);
+    return (size_t)(age * (float)(PARTICLES_LUT_SIZE - 1) + 0.5f);
+}
 
 
 /*
@@ -15,23 +126,59 @@
 static void particles_init(particles_s* p, const particles_desc_s* desc) {
     assert(p && desc);
     assert(desc->max_particles > 0);
+    for (size_t i = 1; i < desc->num_color_stops; i++) {
+        assert(desc->color_stops[i - 1].t <= desc->color_stops[i].t);
+    }
+    for (size_t i = 1; i < desc->num_size_stops; i++) {
+        assert(desc->size_stops[i - 1].t <= desc->size_stops[i].t);
+    }
+
+    const size_t n = desc->max_particles;
+    const size_t vec3_size = align_to_cache_line(n * sizeof(vec3s));
+    const size_t vec4_size = align_to_cache_line(n * sizeof(vec4s));
+    const size_t float_size = align_to_cache_line(n * sizeof(float));
+
+    // attributes of the same class share a region, so the update streams
+    // through the hot region without pulling in spawn-only data
+    uint8_t* hot = aligned_alloc(PARTICLES_CACHE_LINE, 2 * vec3_size + 2 * float_size);
+    uint8_t* warm = aligned_alloc(PARTICLES_CACHE_LINE, vec4_size + float_size);
+    assert(hot && warm);
     
     *p = (particles_s){
         .num_particles = 0,
-        .positions = malloc(desc->max_particles * sizeof(vec3s)),
-        .velocities = malloc(desc->max_particles * sizeof(vec3s)),
-        .lifetimes = malloc(desc->max_particles * sizeof(float)), 
-        .colors = malloc(desc->max_particles * sizeof(vec4s)), 
-        .start_color = desc->start_color,
-        .end_color = desc->end_color
+        .positions = (vec3s*)hot,
+        .velocities = (vec3s*)(hot + vec3_size),
+        .lifetimes = (float*)(hot + 2 * vec3_size),
+        .inv_lifetimes = (float*)(hot + 2 * vec3_size + float_size),
+        .colors = (vec4s*)warm,
+        .sizes = (float*)(warm + vec4_size),
+        .chunk_alive = malloc((n + PARTICLES_CHUNK_SIZE - 1) / PARTICLES_CHUNK_SIZE * sizeof(size_t)),
+        .hot_block = hot,
+        .warm_block = warm
     };
+    assert(p->chunk_alive);
+
+    if (desc->trail_length > 0) {
+        p->trail_length = desc->trail_length;
+        p->trail_stride = n;
+        p->trails = aligned_alloc(PARTICLES_CACHE_LINE, desc->trail_length * vec3_size);
+        assert(p->trails);
+    }
 
-    assert(
-        p->positions && 
-        p->velocities && 
-        p->lifetimes && 
-        p->colors
-    );
+    if (desc->num_color_stops > 0) {
+        bake_color_lut(p->color_lut, desc->color_stops, desc->num_color_stops);
+    } else {
+        bake_color_lut(p->color_lut, (color_stop_s[]){
+            { .t = 0.0f, .color = desc->start_color },
+            { .t = 1.0f, .color = desc->end_color }
+        }, 2);
+    }
+
+    if (desc->num_size_stops > 0) {
+        bake_size_lut(p->size_lut, desc->size_stops, desc->num_size_stops);
+    } else {
+        bake_size_lut(p->size_lut, &(size_stop_s){ .t = 0.0f, .size = 1.0f }, 1);
+    }
 }
 
 /*
@@ -41,52 +188,341 @@ static void particles_init(particles_s* p, const particles_desc_s* desc) {
  */
 static void particles_deinit(particles_s* p) {
     if (p) {
-        free(p->positions);
-        free(p->velocities);
-        free(p->lifetimes);
-        free(p->colors);
+        free(p->hot_block);
+        free(p->warm_block);
+        free(p->trails);
+        free(p->chunk_alive);
         *p = (particles_s){ };
     }
 }
 
 /*
- * @brief Updates particle positions, lifetimes, and colors
+ * @brief Copies the state an update reads into another slot, the hot
+ * attributes and the trail history
+ *
+ * @param p Pointer to the particles structure
+ * @param dst Slot to overwrite
+ * @param src Slot to copy from
+ */
+static void particles_copy_hot(particles_s* p, size_t dst, size_t src) {
+    p->positions[dst] = p->positions[src];
+    p->velocities[dst] = p->velocities[src];
+    p->lifetimes[dst] = p->lifetimes[src];
+    p->inv_lifetimes[dst] = p->inv_lifetimes[src];
+
+    for (size_t k = 0; k < p->trail_length; k++) {
+        p->trails[k * p->trail_stride + dst] = p->trails[k * p->trail_stride + src];
+    }
+}
+
+/*
+ * @brief Copies a particle into another slot, including its trail history
+ *
+ * @param p Pointer to the particles structure
+ * @param dst Slot to overwrite
+ * @param src Slot to copy from
+ */
+static void particles_copy(particles_s* p, size_t dst, size_t src) {
+    particles_copy_hot(p, dst, src);
+    p->colors[dst] = p->colors[src];
+    p->sizes[dst] = p->sizes[src];
+}
+
+/*
+ * @brief Updates a range of particles and removes the expired ones
+ *
+ * An expired particle is replaced by the last particle of the range, which
+ * is then updated in its place. Only deaths cost a copy, and only of the
+ * hot attributes and the history, the update rewrites the warm ones right
+ * after. Survivors read their hot attributes and write back position and
+ * lifetime, the warm attributes are written but never read.
  *
  * @param p Pointer to the particles structure to update
  * @param dt Time delta in seconds
+ * @param begin First particle of the range
+ * @param end One past the last particle of the range
+ * @param trail_slot History slot of this update, nullptr without trails
+ * @param moved Incremented by the number of particles copied, hot only
+ *
+ * @returns Number of survivors, they occupy the start of the range
  */
-static void particles_update(particles_s* p, float dt) {
-    assert(p && dt >= 0.0f);
-    
-    size_t i = 0;
-    while (i < p->num_particles) {
-        p->lifetimes[i] -= dt;
-
-        // if lifetime expired, remove particle by swapping with the last one
-        if (p->lifetimes[i] <= 0.0f) {
-            p->positions[i] = p->positions[p->num_particles - 1];
-            p->velocities[i] = p->velocities[p->num_particles - 1];
-            p->lifetimes[i] = p->lifetimes[p->num_particles - 1];
-            p->colors[i] = p->colors[p->num_particles - 1];
-            p->num_particles--;
+static size_t particles_update_range(particles_s* p, float dt, 
+                                     size_t begin, size_t end, 
+                                     vec3s* trail_slot, size_t* moved) {
+    assert(p && begin <= end && moved);
+
+    size_t i = begin;
+    while (i < end) {
+        const float lifetime = p->lifetimes[i] - dt;
+
+        if (lifetime <= 0.0f) {
+            end--;
+            if (i != end) {
+                particles_copy_hot(p, i, end);
+                (*moved)++;
+            }
             continue;
         }
 
         p->positions[i] = glms_vec3_add(p->positions[i], glms_vec3_scale(p->velocities[i], dt));
+        p->lifetimes[i] = lifetime;
 
-        assert(p->lifetimes[i] > 0.0f);
-        vec4s delta_color = glms_vec4_divs(
-            glms_vec4_sub(p->end_color, p->start_color), 
-            p->lifetimes[i]
-        );
+        // sample the curves by normalized age, constant cost for any curve
+        const size_t idx = lut_index(1.0f - lifetime * p->inv_lifetimes[i]);
+        p->colors[i] = p->color_lut[idx];
+        p->sizes[i] = p->size_lut[idx];
 
-        p->colors[i] = glms_vec4_add(
-            p->colors[i], 
-            glms_vec4_scale(delta_color, dt)
-        );
+        if (trail_slot) {
+            trail_slot[i] = p->positions[i];
+        }
 
         i++;
     }
+
+    return end - begin;
+}
+
+typedef struct update_job {
+    particles_s* p;
+    float dt;
+    vec3s* trail_slot;
+    size_t first_chunk;
+    size_t last_chunk;
+    size_t moved;
+} update_job_s;
+
+/*
+ * @brief Pool task, updates a contiguous run of chunks in place
+ *
+ * @param arg Array of update jobs, one per thread
+ * @param worker Index of the job to run
+ */
+static void update_chunks(void* arg, size_t worker) {
+    update_job_s* job = (update_job_s*)arg + worker;
+    particles_s* p = job->p;
+
+    for (size_t c = job->first_chunk; c < job->last_chunk; c++) {
+        const size_t begin = c * PARTICLES_CHUNK_SIZE;
+        const size_t end = begin + PARTICLES_CHUNK_SIZE < p->num_particles 
+            ? begin + PARTICLES_CHUNK_SIZE 
+            : p->num_particles;
+
+        // survivors stay inside their chunk, no other thread touches it
+        p->chunk_alive[c] = particles_update_range(p, job->dt, begin, end, job->trail_slot, &job->moved);
+    }
+}
+
+/*
+ * @brief Thread entry of a pool worker, runs every task until told to quit
+ *
+ * @param arg Pointer to the worker
+ */
+static void* pool_worker(void* arg) {
+    const particles_worker_s* w = arg;
+    particles_pool_s* pool = w->pool;
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->generation == seen && !pool->quit) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->quit) {
+            break;
+        }
+        seen = pool->generation;
+
+        pthread_mutex_unlock(&pool->lock);
+        pool->task(pool->arg, w->index);
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return nullptr;
+}
+
+/*
+ * @brief Starts the worker threads, the calling thread counts as one
+ *
+ * @param pool Pointer to the pool to initialize, must not move afterwards
+ * @param num_threads Number of threads, 0 or 1 runs every task serially
+ *
+ * @note The caller is responsible for calling pool_deinit()
+ */
+static void pool_init(particles_pool_s* pool, size_t num_threads) {
+    assert(pool && num_threads <= PARTICLES_MAX_THREADS);
+
+    *pool = (particles_pool_s){
+        .num_threads = num_threads > 1 ? num_threads : 1
+    };
+    if (pool->num_threads == 1) {
+        return;
+    }
+
+    pthread_mutex_init(&pool->lock, nullptr);
+    pthread_cond_init(&pool->wake, nullptr);
+    pthread_cond_init(&pool->done, nullptr);
+
+    for (size_t t = 1; t < pool->num_threads; t++) {
+        pool->workers[t] = (particles_worker_s){ .pool = pool, .index = t };
+        const int err = pthread_create(&pool->threads[t], nullptr, pool_worker, &pool->workers[t]);
+        assert(err == 0);
+        (void)err;
+    }
+}
+
+/*
+ * @brief Stops and joins the worker threads
+ *
+ * @param pool Pointer to the pool to deinitialize
+ */
+static void pool_deinit(particles_pool_s* pool) {
+    assert(pool);
+
+    if (pool->num_threads > 1) {
+        pthread_mutex_lock(&pool->lock);
+        pool->quit = true;
+        pthread_cond_broadcast(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+
+        for (size_t t = 1; t < pool->num_threads; t++) {
+            pthread_join(pool->threads[t], nullptr);
+        }
+
+        pthread_cond_destroy(&pool->done);
+        pthread_cond_destroy(&pool->wake);
+        pthread_mutex_destroy(&pool->lock);
+    }
+    *pool = (particles_pool_s){ };
+}
+
+/*
+ * @brief Runs a task on every thread of the pool and waits for all of them
+ *
+ * @param pool Pointer to the pool
+ * @param task Function called once per thread with the thread index
+ * @param arg Argument passed to every call
+ */
+static void pool_run(particles_pool_s* pool, pool_task_func task, void* arg) {
+    assert(pool && task);
+
+    if (pool->num_threads > 1) {
+        pthread_mutex_lock(&pool->lock);
+        pool->task = task;
+        pool->arg = arg;
+        pool->pending = pool->num_threads - 1;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    task(arg, 0);
+
+    if (pool->num_threads > 1) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->pending > 0) {
+            pthread_cond_wait(&pool->done, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+/*
+ * @brief Closes the gaps the chunk updates left behind
+ *
+ * Gaps below the final particle count are filled with the last survivors,
+ * so the copies are proportional to the deaths and not to the survivors.
+ *
+ * @param p Pointer to the particles structure
+ * @param num_chunks Number of chunks of the update
+ *
+ * @returns Number of particles copied
+ */
+static size_t join_chunks(particles_s* p, size_t num_chunks) {
+    size_t alive = 0;
+    for (size_t c = 0; c < num_chunks; c++) {
+        alive += p->chunk_alive[c];
+    }
+
+    size_t moved = 0;
+    size_t src_chunk = num_chunks - 1;
+    size_t src_end = src_chunk * PARTICLES_CHUNK_SIZE + p->chunk_alive[src_chunk];
+
+    for (size_t c = 0; c < num_chunks && c * PARTICLES_CHUNK_SIZE < alive; c++) {
+        const size_t gap_end = (c + 1) * PARTICLES_CHUNK_SIZE < alive 
+            ? (c + 1) * PARTICLES_CHUNK_SIZE 
+            : alive;
+
+        for (size_t dst = c * PARTICLES_CHUNK_SIZE + p->chunk_alive[c]; dst < gap_end; dst++) {
+            // the last survivor not yet moved, always at or above alive
+            while (src_end == src_chunk * PARTICLES_CHUNK_SIZE) {
+                src_chunk--;
+                src_end = src_chunk * PARTICLES_CHUNK_SIZE + p->chunk_alive[src_chunk];
+            }
+            particles_copy(p, dst, --src_end);
+            moved++;
+        }
+    }
+
+    p->num_particles = alive;
+    return moved;
+}
+
+/*
+ * @brief Updates particle positions, lifetimes, colors and sizes
+ *
+ * The particles are split into chunks of the fixed PARTICLES_CHUNK_SIZE,
+ * each updated in place by one thread, then the gaps are closed in chunk
+ * order. The chunks do not depend on the number of threads, so neither
+ * does the result, it is bit identical for any thread count.
+ *
+ * @param p Pointer to the particles structure to update
+ * @param dt Time delta in seconds
+ * @param pool Pointer to the pool running the chunks
+ */
+static void particles_update(particles_s* p, float dt, particles_pool_s* pool) {
+    assert(p && pool && dt >= 0.0f);
+    
+    const size_t n = p->num_particles;
+    const size_t num_chunks = (n + PARTICLES_CHUNK_SIZE - 1) / PARTICLES_CHUNK_SIZE;
+
+    // the positions of this update go into the next slot of the ring
+    vec3s* trail_slot = nullptr;
+    if (p->trail_length > 0) {
+        p->trail_head = (p->trail_head + 1) % p->trail_length;
+        trail_slot = p->trails + p->trail_head * p->trail_stride;
+    }
+
+    p->num_moved = 0;
+    p->num_joined = 0;
+    if (num_chunks == 0) {
+        return;
+    }
+
+    // every thread gets a job, with fewer chunks than threads some are empty
+    const size_t num_threads = pool->num_threads;
+    update_job_s jobs[PARTICLES_MAX_THREADS];
+    for (size_t t = 0; t < num_threads; t++) {
+        jobs[t] = (update_job_s){
+            .p = p,
+            .dt = dt,
+            .trail_slot = trail_slot,
+            .first_chunk = t * num_chunks / num_threads,
+            .last_chunk = (t + 1) * num_chunks / num_threads,
+            .moved = 0
+        };
+    }
+
+    pool_run(pool, update_chunks, jobs);
+
+    for (size_t t = 0; t < num_threads; t++) {
+        p->num_moved += jobs[t].moved;
+    }
+    p->num_joined = join_chunks(p, num_chunks);
 }
 
 /*
@@ -94,17 +530,29 @@ static void particles_update(particles_s* p, float dt) {
  *
  * @param p Pointer to the particles structure
  * @param desc Pointer to the particle description structure
+ * @param age Time in seconds the particle already lived, less than its lifetime
  *
  * @note The caller must ensure there is enough capacity
  */
-static void particles_add(particles_s* p, const particle_desc_s* desc) {
+static void particles_add(particles_s* p, const particle_desc_s* desc, float age) {
     assert(p && desc);
+    assert(desc->lifetime > 0.0f && age >= 0.0f && age < desc->lifetime);
     
     const size_t idx = p->num_particles++;
-    p->positions[idx] = desc->position;
+    p->positions[idx] = glms_vec3_add(desc->position, glms_vec3_scale(desc->velocity, age));
     p->velocities[idx] = desc->velocity;
-    p->lifetimes[idx] = desc->lifetime;
-    p->colors[idx] = p->start_color;
+    p->lifetimes[idx] = desc->lifetime - age;
+    p->inv_lifetimes[idx] = 1.0f / desc->lifetime;
+
+    const size_t lut_idx = lut_index(age * p->inv_lifetimes[idx]);
+    p->colors[idx] = p->color_lut[lut_idx];
+    p->sizes[idx] = p->size_lut[lut_idx];
+
+    // the whole history starts at the spawn position, so the ribbons
+    // never need to know how much of it has been recorded
+    for (size_t k = 0; k < p->trail_length; k++) {
+        p->trails[k * p->trail_stride + idx] = p->positions[idx];
+    }
 }
 
 /*
@@ -118,16 +566,25 @@ static void particles_add(particles_s* p, const particle_desc_s* desc) {
 void emitter_init(emitter_s* e, const emitter_desc_s* desc) {
     assert(e && desc);
     assert(desc->emission_rate >= 0.0f);
+    assert(desc->fixed_dt >= 0.0f);
+    assert(desc->num_threads <= PARTICLES_MAX_THREADS);
     assert(desc->emit);
     assert(desc->particles_desc);
     
     *e = (emitter_s){
         .emission_rate = desc->emission_rate,
         .emission_accum = 0.0f,
+        .position = desc->position,
+        .prev_position = desc->position,
+        .fixed_dt = desc->fixed_dt,
+        .step_accum = 0.0f,
+        .rng_state = desc->seed,
         .max_particles = desc->particles_desc->max_particles,
+        .spawn_limit = desc->particles_desc->max_particles,
         .emit = desc->emit
     };
     particles_init(&e->particles, desc->particles_desc);
+    pool_init(&e->pool, desc->num_threads);
 }
 
 /*
@@ -137,6 +594,7 @@ void emitter_init(emitter_s* e, const emitter_desc_s* desc) {
  */
 void emitter_deinit(emitter_s* e) {
     if (e) {
+        pool_deinit(&e->pool);
         particles_deinit(&e->particles);
         *e = (emitter_s){ };
     }
@@ -151,25 +609,82 @@ void emitter_deinit(emitter_s* e) {
 void emitter_update(emitter_s* e, float dt) {
     assert(e && dt >= 0.0f);
 
-    particles_update(&e->particles, dt);
+    particles_update(&e->particles, dt, &e->pool);
+}
+
+/*
+ * @brief Updates the particles and emits new ones for a frame
+ *
+ * In lockstep mode the frame time is accumulated and consumed in steps of
+ * fixed_dt, so the simulation only depends on the number of steps and not
+ * on how the time was split into frames. A frame running several steps
+ * moves the emitter position linearly across them.
+ *
+ * @param e Pointer to the emitter structure to advance
+ * @param dt Frame time in seconds
+ */
+void emitter_advance(emitter_s* e, float dt) {
+    assert(e && dt >= 0.0f);
+
+    if (e->fixed_dt <= 0.0f) {
+        emitter_update(e, dt);
+        emitter_emit_timed(e, dt);
+        return;
+    }
+
+    // prev_position is where the last step ended, step_accum seconds before
+    // this frame began, every step moves the emitter along to the target
+    const vec3s from = e->prev_position;
+    const vec3s target = e->position;
+    const float span = e->step_accum + dt;
+    float consumed = 0.0f;
+
+    e->step_accum += dt;
+    while (e->step_accum >= e->fixed_dt) {
+        consumed += e->fixed_dt;
+        e->position = glms_vec3_lerp(from, target, consumed / span);
+
+        emitter_update(e, e->fixed_dt);
+        emitter_emit_timed(e, e->fixed_dt);
+        e->step_accum -= e->fixed_dt;
+    }
+    e->position = target;
 }
 
 /*
  * @brief Emits particles based on the emission rate and time delta
  *
+ * The spawns are spread over the frame interval instead of all starting at
+ * the end of it. Each particle is advanced by the time it already lived
+ * within the frame and starts from the emitter position at its spawn time.
+ *
  * @param e Pointer to the emitter structure
  * @param dt Time delta in seconds
+ *
+ * @note Call after emitter_update(), the new particles are already advanced
  */
 void emitter_emit_timed(emitter_s* e, float dt) {
     assert(e && e->emit && dt >= 0.0f);
     
     e->emission_accum += e->emission_rate * dt;
+    e->spawn_dt = dt;
 
     while (e->emission_accum >= 1.0f &&
-           e->particles.num_particles < e->max_particles) {
+           e->particles.num_particles < e->spawn_limit) {
+        // the accumulator crossed the threshold (accum - 1) / rate seconds
+        // ago, spawns held back by a full emitter start at the frame begin
+        const float age = e->emission_rate > 0.0f
+            ? (e->emission_accum - 1.0f) / e->emission_rate
+            : dt;
+        e->spawn_age = age < dt ? age : dt;
+
         e->emit(e);
         e->emission_accum -= 1.0f;
     }
+
+    e->spawn_age = 0.0f;
+    e->spawn_dt = 0.0f;
+    e->prev_position = e->position;
 }
 
 /* @brief Emits a fixed number of particles immediately
@@ -180,7 +695,7 @@ void emitter_emit_timed(emitter_s* e, float dt) {
 void emitter_emit_batch(emitter_s* e, size_t size) {
     assert(e && e->emit);
     
-    for (size_t i = 0; i < size && e->particles.num_particles < e->max_particles; i++) {
+    for (size_t i = 0; i < size && e->particles.num_particles < e->spawn_limit; i++) {
         e->emit(e);
     }
 }
@@ -196,10 +711,106 @@ void emitter_emit_batch(emitter_s* e, size_t size) {
 bool emitter_add_particle(emitter_s* e, const particle_desc_s* desc) {
     assert(e && desc);
     
-    if (e->particles.num_particles >= e->max_particles) {
+    if (e->particles.num_particles >= e->spawn_limit) {
         return false;
     }
 
-    particles_add(&e->particles, desc);
+    // born and expired within the frame, nothing left to simulate
+    if (desc->lifetime <= e->spawn_age) {
+        return true;
+    }
+
+    const vec3s origin = e->spawn_dt > 0.0f
+        ? glms_vec3_lerp(e->position, e->prev_position, e->spawn_age / e->spawn_dt)
+        : e->position;
+
+    particles_add(&e->particles, &(particle_desc_s){
+        .position = glms_vec3_add(origin, desc->position),
+        .velocity = desc->velocity,
+        .lifetime = desc->lifetime
+    }, e->spawn_age);
     return true;
 }
+
+/*
+ * @brief Draws the next number of the emitter's random stream
+ *
+ * The stream (splitmix64) only depends on the seed and the number of draws,
+ * so emit callbacks using it spawn the same particles on every run.
+ *
+ * @param e Pointer to the emitter structure
+ * @param min Lower bound, inclusive
+ * @param max Upper bound, exclusive
+ *
+ * @returns A uniformly distributed number in [min, max)
+ */
+float emitter_randf(emitter_s* e, float min, float max) {
+    assert(e);
+
+    uint64_t z = (e->rng_state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+
+    // top 24 bits are exactly representable as a float in [0, 1)
+    const float r = (float)(z >> 40) * 0x1.0p-24f;
+    return min + r * (max - min);
+}
+
+/*
+ * @brief Hashes a block of memory (FNV-1a)
+ *
+ * @param hash Hash to continue from
+ * @param data Pointer to the data
+ * @param size Size of the data in bytes
+ */
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/*
+ * @brief Computes a checksum over the simulated state
+ *
+ * Every particle is hashed together with its index and its trail history
+ * and the hashes are summed, so the reduction can be split in any order
+ * and still changes when particles are reordered or any bit of their
+ * state differs. The emitter state that drives the next steps, the random
+ * stream, the accumulators and the ring head, is hashed as well.
+ *
+ * @param e Pointer to the emitter structure
+ *
+ * @returns Checksum of the simulated state
+ */
+uint64_t emitter_checksum(const emitter_s* e) {
+    assert(e);
+
+    const particles_s* p = &e->particles;
+    uint64_t state = hash_bytes(0xCBF29CE484222325ull, &p->num_particles, sizeof(size_t));
+    state = hash_bytes(state, &p->trail_head, sizeof(size_t));
+    state = hash_bytes(state, &e->rng_state, sizeof(uint64_t));
+    state = hash_bytes(state, &e->emission_accum, sizeof(float));
+    state = hash_bytes(state, &e->step_accum, sizeof(float));
+    state = hash_bytes(state, e->prev_position.raw, sizeof(vec3));
+    uint64_t sum = state;
+
+    for (size_t i = 0; i < p->num_particles; i++) {
+        uint64_t hash = hash_bytes(0xCBF29CE484222325ull, &i, sizeof(size_t));
+        hash = hash_bytes(hash, p->positions[i].raw, sizeof(vec3));
+        hash = hash_bytes(hash, p->velocities[i].raw, sizeof(vec3));
+        hash = hash_bytes(hash, &p->lifetimes[i], sizeof(float));
+        hash = hash_bytes(hash, &p->inv_lifetimes[i], sizeof(float));
+        hash = hash_bytes(hash, p->colors[i].raw, sizeof(vec4));
+        hash = hash_bytes(hash, &p->sizes[i], sizeof(float));
+
+        for (size_t k = 0; k < p->trail_length; k++) {
+            hash = hash_bytes(hash, p->trails[k * p->trail_stride + i].raw, sizeof(vec3));
+        }
+        sum += hash;
+    }
+
+    return sum;
+}
@@ -1,43 +1,143 @@
 #pragma once
 
 #include "cglm/struct.h"
+#include <pthread.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#define PARTICLES_LUT_SIZE 256
+
+#define PARTICLES_CACHE_LINE 64
+
+// updates split the particles into chunks of a fixed size, so the result
+// does not depend on the number of threads
+#define PARTICLES_CHUNK_SIZE 16384
+#define PARTICLES_MAX_THREADS 64
+
+// bytes per particle of each attribute class
+#define PARTICLES_HOT_BYTES (2 * sizeof(vec3s) + 2 * sizeof(float))
+#define PARTICLES_WARM_BYTES (sizeof(vec4s) + sizeof(float))
+
 
 typedef struct particles {
     size_t num_particles;
+    size_t num_moved;  // particles the last update copied within a chunk, hot only
+    size_t num_joined; // particles the last update copied across chunks, in full
 
+    // hot, read by every update, one contiguous region
     vec3s* positions;
     vec3s* velocities;
     float* lifetimes;
+    float* inv_lifetimes; // 1 / initial lifetime, to compute the normalized age
 
-    vec4s start_color;
-    vec4s end_color;
+    // warm, only written by the update and read for the upload
     vec4s* colors;
+    float* sizes; // scale of the QUAD_SIZE billboard
+
+    // trail history, trail_length slots of trail_stride positions each,
+    // all particles share the ring head as they record at the same time
+    size_t trail_length;
+    size_t trail_stride;
+    size_t trail_head;
+    vec3s* trails;
+
+    size_t* chunk_alive; // survivors per chunk of a parallel update
+
+    void* hot_block;
+    void* warm_block;
+
+    // cold, color and size over normalized age, baked at init and only
+    // read through the sampled index
+    vec4s color_lut[PARTICLES_LUT_SIZE];
+    float size_lut[PARTICLES_LUT_SIZE];
 } particles_s;
 
 typedef struct particle_desc {
-    vec3s position;
+    vec3s position; // relative to the emitter position
     vec3s velocity;
     float lifetime;
 } particle_desc_s;
 
+typedef struct color_stop {
+    float t; // normalized age in [0, 1]
+    vec4s color;
+} color_stop_s;
+
+typedef struct size_stop {
+    float t; // normalized age in [0, 1]
+    float size;
+} size_stop_s;
+
 typedef struct particles_desc {
     size_t max_particles;
     vec4s start_color;
     vec4s end_color;
+
+    // optional curves, stops must be sorted by t
+    // without color stops start_color and end_color are blended linearly,
+    // without size stops the size stays at 1.0
+    const color_stop_s* color_stops;
+    size_t num_color_stops;
+    const size_stop_s* size_stops;
+    size_t num_size_stops;
+
+    // positions kept per particle for trails, 0 disables the history
+    size_t trail_length;
 } particles_desc_s;
 
 
+typedef struct particles_pool particles_pool_s; // forward declaration
+typedef void (*pool_task_func)(void* arg, size_t worker);
+
+typedef struct particles_worker {
+    particles_pool_s* pool;
+    size_t index; // 0 is the calling thread, workers start at 1
+} particles_worker_s;
+
+// threads of the parallel update, started once and woken for every task
+typedef struct particles_pool {
+    size_t num_threads; // including the calling thread
+    pthread_t threads[PARTICLES_MAX_THREADS];
+    particles_worker_s workers[PARTICLES_MAX_THREADS];
+
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    uint64_t generation; // incremented for every task
+    size_t pending;      // workers still running the current task
+    bool quit;
+
+    pool_task_func task;
+    void* arg;
+} particles_pool_s;
+
+
 typedef struct emitter emitter_s; // forward declaration
 typedef void (*emit_func)(struct emitter* e);
 
 typedef struct emitter {
     float emission_rate; // particles per second
     float emission_accum; // accumulator to track emission timing           
+
+    // set position before emitter_emit_timed(), timed spawns are
+    // interpolated between the previous and the current position
+    vec3s position;
+    vec3s prev_position;
+
+    // time the particle currently being emitted was spawned before the
+    // end of the frame, and the duration of that frame
+    float spawn_age;
+    float spawn_dt;
+
+    // lockstep mode, with fixed_dt > 0 emitter_advance() only runs whole steps
+    float fixed_dt;
+    float step_accum;
+
+    uint64_t rng_state; // random stream of this emitter, see emitter_randf()
+    particles_pool_s pool; // the emitter must not move while it is running
     
-    size_t max_particles;
+    size_t max_particles; // capacity of the particle arrays
+    size_t spawn_limit;   // particles held at most, lowered by gpu_sim_update()
     particles_s particles;
 
     emit_func emit;
@@ -45,14 +145,22 @@ typedef struct emitter {
 
 typedef struct emitter_desc {
     float emission_rate;
+    vec3s position;
     emit_func emit;
 
+    float fixed_dt; // 0 to advance by the frame time
+    uint64_t seed;
+    size_t num_threads; // threads used by the update, 0 or 1 runs serially
+
     const particles_desc_s* particles_desc;
 } emitter_desc_s;
 
 void emitter_init(emitter_s* e, const emitter_desc_s* desc);
 void emitter_deinit(emitter_s* e);
 void emitter_update(emitter_s* e, float dt);
+void emitter_advance(emitter_s* e, float dt);
 void emitter_emit_timed(emitter_s* e, float dt);
 void emitter_emit_batch(emitter_s* e, size_t size);
 bool emitter_add_particle(emitter_s* e, const particle_desc_s* desc);
+float emitter_randf(emitter_s* e, float min, float max);
+uint64_t emitter_checksum(const emitter_s* e);
@@ -11,3 +11,25 @@ const uint16_t quad_indices[6] = {
     0, 1, 2,
     0, 2, 3
 };
+
+// tight billboard around the non-transparent texels of the texture,
+// generated with: fuzzball_generator.py -d 16 -o
+const vertex_s octagon_vertices[8] = {
+    { .pos = {{  1.0000f * QUAD_SIZE,  0.6250f * QUAD_SIZE, 0.0f }}, .uv = {{ 1.0000f, 0.1875f }} },
+    { .pos = {{  0.6250f * QUAD_SIZE,  1.0000f * QUAD_SIZE, 0.0f }}, .uv = {{ 0.8125f, 0.0000f }} },
+    { .pos = {{ -0.6250f * QUAD_SIZE,  1.0000f * QUAD_SIZE, 0.0f }}, .uv = {{ 0.1875f, 0.0000f }} },
+    { .pos = {{ -1.0000f * QUAD_SIZE,  0.6250f * QUAD_SIZE, 0.0f }}, .uv = {{ 0.0000f, 0.1875f }} },
+    { .pos = {{ -1.0000f * QUAD_SIZE, -0.6250f * QUAD_SIZE, 0.0f }}, .uv = {{ 0.0000f, 0.8125f }} },
+    { .pos = {{ -0.6250f * QUAD_SIZE, -1.0000f * QUAD_SIZE, 0.0f }}, .uv = {{ 0.1875f, 1.0000f }} },
+    { .pos = {{  0.6250f * QUAD_SIZE, -1.0000f * QUAD_SIZE, 0.0f }}, .uv = {{ 0.8125f, 1.0000f }} },
+    { .pos = {{  1.0000f * QUAD_SIZE, -0.6250f * QUAD_SIZE, 0.0f }}, .uv = {{ 1.0000f, 0.8125f }} }
+};
+
+const uint16_t octagon_indices[18] = {
+    0, 1, 2,
+    0, 2, 3,
+    0, 3, 4,
+    0, 4, 5,
+    0, 5, 6,
+    0, 6, 7
+};
@@ -3,7 +3,7 @@
 #include "cglm/struct.h"
 #include <stdint.h>
 
-#define QUAD_SIZE 0.05f
+#define QUAD_SIZE 0.05f // half extent, scaled per instance by the size curve
 
 typedef struct vertex {
     vec3s pos;
@@ -12,3 +12,6 @@ typedef struct vertex {
 
 extern const vertex_s quad_vertices[4];
 extern const uint16_t quad_indices[6];
+
+extern const vertex_s octagon_vertices[8];
+extern const uint16_t octagon_indices[18];
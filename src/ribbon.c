@@ -0,0 +1,114 @@
+#include "ribbon.h"
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+
+
+// particles per block, the vertices of a block stay in cache while all
+// of its history slots are written
+#define RIBBON_BLOCK_SIZE 64
+
+
+/*
+ * @brief Fills the index buffer for the ribbons of all particle slots
+ *
+ * The topology only depends on the trail length, particles with a shorter
+ * history repeat their spawn position and produce degenerate quads.
+ *
+ * @param max_particles Capacity of the particles structure
+ * @param trail_length Positions kept per particle, at least two
+ * @param indices Output, RIBBON_INDICES_PER_PARTICLE(trail_length) per particle
+ */
+void ribbon_build_indices(size_t max_particles, size_t trail_length, uint32_t* indices) {
+    assert(indices && trail_length >= 2);
+
+    for (size_t i = 0; i < max_particles; i++) {
+        const uint32_t base = (uint32_t)(i * RIBBON_VERTICES_PER_PARTICLE(trail_length));
+
+        for (size_t j = 0; j + 1 < trail_length; j++) {
+            const uint32_t v = base + (uint32_t)(j * 2);
+            *indices++ = v;
+            *indices++ = v + 1;
+            *indices++ = v + 3;
+            *indices++ = v;
+            *indices++ = v + 3;
+            *indices++ = v + 2;
+        }
+    }
+}
+
+/*
+ * @brief Generates camera facing ribbon geometry from the trail history
+ *
+ * Walks the history slot by slot over blocks of particles, the ring
+ * indices are computed once per slot and the inner loop runs over the
+ * particles of the block, which are contiguous in each slot. It has no
+ * branches and vectorizes in builds with -O3 -fno-math-errno, the
+ * default debug build does neither. New particles have every slot filled
+ * with their spawn position, the missing part of their history has no
+ * tangent and collapses to zero width. Width and alpha taper off towards
+ * the end of the trail.
+ *
+ * @param p Pointer to the particles structure with trail history
+ * @param eye Camera position in world space
+ * @param half_width Half of the ribbon width at the particle
+ * @param vertices Output, RIBBON_VERTICES_PER_PARTICLE(trail_length) per particle
+ *
+ * @returns Number of vertices written
+ */
+size_t ribbon_build_vertices(const particles_s* p, vec3s eye, float half_width, ribbon_vertex_s* vertices) {
+    assert(p && vertices);
+    assert(p->trail_length >= 2);
+
+    const size_t len = p->trail_length;
+    const size_t num_particles = p->num_particles;
+    const size_t vertex_stride = RIBBON_VERTICES_PER_PARTICLE(len);
+    const float taper = 1.0f / (float)(len - 1);
+
+    for (size_t block = 0; block < num_particles; block += RIBBON_BLOCK_SIZE) {
+        const size_t count = num_particles - block < RIBBON_BLOCK_SIZE
+            ? num_particles - block
+            : RIBBON_BLOCK_SIZE;
+
+        for (size_t j = 0; j < len; j++) {
+            // j counts back from the newest position, neighbours clamp at the ends
+            const size_t at = (p->trail_head + len - j) % len;
+            const size_t newer_at = j > 0 ? (at + 1) % len : at;
+            const size_t older_at = j + 1 < len ? (at + len - 1) % len : at;
+
+            const vec3s* restrict points = p->trails + at * p->trail_stride + block;
+            const vec3s* restrict newer = p->trails + newer_at * p->trail_stride + block;
+            const vec3s* restrict older = p->trails + older_at * p->trail_stride + block;
+            const vec4s* restrict colors = p->colors + block;
+            ribbon_vertex_s* restrict out = vertices + block * vertex_stride + j * 2;
+
+            const float fade = 1.0f - (float)j * taper;
+            const float width = half_width * fade;
+
+            for (size_t i = 0; i < count; i++) {
+                const vec3s tangent = glms_vec3_sub(newer[i], older[i]);
+                const vec3s side = glms_vec3_cross(tangent, glms_vec3_sub(eye, points[i]));
+
+                // clamped instead of the branch in glms_vec3_normalize(), a
+                // zero tangent gives a zero side and a degenerate quad
+                const float norm2 = glms_vec3_dot(side, side);
+                const float clamped = norm2 > FLT_MIN ? norm2 : FLT_MIN;
+                const vec3s offset = glms_vec3_scale(side, width / sqrtf(clamped));
+
+                const vec4s color = colors[i];
+                const float alpha = color.a * fade;
+                ribbon_vertex_s* restrict v = out + i * vertex_stride;
+
+                v[0].pos = glms_vec3_add(points[i], offset);
+                v[1].pos = glms_vec3_sub(points[i], offset);
+                v[0].color.r = v[1].color.r = color.r;
+                v[0].color.g = v[1].color.g = color.g;
+                v[0].color.b = v[1].color.b = color.b;
+                v[0].color.a = v[1].color.a = alpha;
+            }
+        }
+    }
+
+    return num_particles * vertex_stride;
+}
@@ -0,0 +1,30 @@
+@vs ribbon_vs
+layout(binding=0) uniform ribbon_vs_params {
+    mat4 model;
+    mat4 view;
+    mat4 proj;
+};
+
+in vec3 pos;
+in vec4 color0;
+
+out vec4 color;
+
+void main() {
+    gl_Position = proj * view * model * vec4(pos, 1.0f);
+
+    color = color0;
+}
+@end
+
+@fs ribbon_fs
+in vec4 color;
+
+out vec4 frag_color;
+
+void main() {
+    frag_color = color;
+}
+@end
+
+@program ribbon ribbon_vs ribbon_fs
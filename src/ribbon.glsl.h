@@ -0,0 +1,141 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i src/ribbon.glsl -o src/ribbon.glsl.h -l glsl430
+
+    Overview:
+    =========
+    Shader program: 'ribbon':
+        Get shader desc: ribbon_shader_desc(sg_query_backend());
+        Vertex Shader: ribbon_vs
+        Fragment Shader: ribbon_fs
+        Attributes:
+            ATTR_ribbon_pos => 0
+            ATTR_ribbon_color0 => 1
+    Bindings:
+        Uniform block 'ribbon_vs_params':
+            C struct: ribbon_vs_params_t
+            Bind slot: UB_ribbon_vs_params => 0
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before ribbon.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define ATTR_ribbon_pos (0)
+#define ATTR_ribbon_color0 (1)
+#define UB_ribbon_vs_params (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct ribbon_vs_params_t {
+    float model[16];
+    float view[16];
+    float proj[16];
+} ribbon_vs_params_t;
+#pragma pack(pop)
+/*
+    #version 430
+
+    uniform vec4 ribbon_vs_params[12];
+    layout(location = 0) in vec3 pos;
+    layout(location = 0) out vec4 color;
+    layout(location = 1) in vec4 color0;
+
+    void main()
+    {
+        gl_Position = ((mat4(ribbon_vs_params[8], ribbon_vs_params[9], ribbon_vs_params[10], ribbon_vs_params[11]) * mat4(ribbon_vs_params[4], ribbon_vs_params[5], ribbon_vs_params[6], ribbon_vs_params[7])) * mat4(ribbon_vs_params[0], ribbon_vs_params[1], ribbon_vs_params[2], ribbon_vs_params[3])) * vec4(pos, 1.0);
+        color = color0;
+    }
+
+*/
+static const uint8_t ribbon_vs_source_glsl430[509] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x72,0x69,0x62,0x62,0x6f,
+    0x6e,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x32,0x5d,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,
+    0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,
+    0x6d,0x61,0x74,0x34,0x28,0x72,0x69,0x62,0x62,0x6f,0x6e,0x5f,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2c,0x20,0x72,0x69,0x62,0x62,0x6f,0x6e,
+    0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x2c,0x20,0x72,
+    0x69,0x62,0x62,0x6f,0x6e,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x30,0x5d,0x2c,0x20,0x72,0x69,0x62,0x62,0x6f,0x6e,0x5f,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x31,0x5d,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,
+    0x34,0x28,0x72,0x69,0x62,0x62,0x6f,0x6e,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x72,0x69,0x62,0x62,0x6f,0x6e,0x5f,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x2c,0x20,0x72,0x69,0x62,0x62,
+    0x6f,0x6e,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2c,
+    0x20,0x72,0x69,0x62,0x62,0x6f,0x6e,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x37,0x5d,0x29,0x29,0x20,0x2a,0x20,0x6d,0x61,0x74,0x34,0x28,0x72,0x69,
+    0x62,0x62,0x6f,0x6e,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2c,0x20,0x72,0x69,0x62,0x62,0x6f,0x6e,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x72,0x69,0x62,0x62,0x6f,0x6e,0x5f,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x72,0x69,0x62,
+    0x62,0x6f,0x6e,0x5f,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,
+    0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 430
+
+    layout(location = 0) out vec4 frag_color;
+    layout(location = 0) in vec4 color;
+
+    void main()
+    {
+        frag_color = color;
+    }
+
+*/
+static const uint8_t ribbon_fs_source_glsl430[135] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* ribbon_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)ribbon_vs_source_glsl430;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)ribbon_fs_source_glsl430;
+            desc.fragment_func.entry = "main";
+            desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[0].glsl_name = "pos";
+            desc.attrs[1].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+            desc.attrs[1].glsl_name = "color0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 12;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "ribbon_vs_params";
+            desc.label = "ribbon_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "cglm/struct.h"
+#include "particles.h"
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct ribbon_vertex {
+    vec3s pos;
+    vec4s color;
+} ribbon_vertex_s;
+
+// two vertices per trail position, (trail_length - 1) quads per particle
+#define RIBBON_VERTICES_PER_PARTICLE(trail_length) ((trail_length) * 2)
+#define RIBBON_INDICES_PER_PARTICLE(trail_length) (((trail_length) - 1) * 6)
+
+void ribbon_build_indices(size_t max_particles, size_t trail_length, uint32_t* indices);
+size_t ribbon_build_vertices(const particles_s* p, vec3s eye, float half_width, ribbon_vertex_s* vertices);